@@ -54,6 +54,10 @@ static inline const char *ds_err_str(ds_err_code_t err)
             return "ERROR_DS_ALLOCATOR_NOT_FOUND";
         case ERROR_DS_PTR_ALLOC_YET:
             return "ERROR_DS_PTR_ALLOC_YET";
+        case ERROR_DS_STALE_HANDLE:
+            return "ERROR_DS_STALE_HANDLE";
+        case ERROR_DS_HANDLE_LOCKED:
+            return "ERROR_DS_HANDLE_LOCKED";
         default:
             return "ERROR_DS_UNKNOWN";
     }
@@ -13,6 +13,14 @@
 #include <stdint.h>
 #include <assert.h>
 
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+#if (DS_ENGINE == DS_ENGINE_BITMAP) && (defined(__AVX2__) || defined(__SSE4_1__))
+    #include <immintrin.h>
+#endif
+
 /*---------Macros-And-Defines---------*/
 
 #ifndef DS_ASSERT
@@ -87,17 +95,72 @@ static inline void ds_zero(void *p_dest, size_t dest_size, size_t size_to_zero);
  */
 static inline void ds_memcpy(void *p_dest, size_t dest_size, const void *p_src, size_t size_to_copy);
 
+#if DS_HANDLES == 1u
 /**
- * @brief Assign an allocator record and a memory region for a new block.
+ * @brief Perform bounds-guarded memory move between regions that may
+ *        overlap.
+ *
+ * The memmove counterpart of ds_memcpy(), for compaction, which slides a
+ * block over space it partly occupied.
+ *
+ * @param[out] p_dest Destination memory.
+ * @param[in] dest_size Guaranteed writable size of the destination.
+ * @param[in] p_src Source memory.
+ * @param[in] size_to_move Number of bytes to move.
+ */
+static inline void ds_memmove(void *p_dest, size_t dest_size, const void *p_src, size_t size_to_move);
+#endif
+
+/**
+ * @brief Check a configuration of ds_initialize_allocation_ex() against
+ *        every rule listed at ds_config_t.
+ *
+ * @param[in] p_config Configuration to check (not NULL).
+ *
+ * @return true when an instance can run over it.
+ */
+static bool ds_config_valid(const ds_config_t *p_config);
+
+/**
+ * @brief Take the next array of @p bytes from the record storage and move
+ *        the cursor past it to the next DS_RECORD_STORAGE_ALIGN boundary.
+ *
+ * @param[in, out] pp_cursor Cursor into the record storage.
+ * @param[in] bytes Size of the array.
+ *
+ * @return Start of the array.
+ */
+static void *ds_carve(uint8_t **pp_cursor, size_t bytes);
+
+/**
+ * @brief Point an instance at its arena and record storage, carve the
+ *        record arrays and bitmaps out of the storage, and reset all state.
  *
- * Serves the request reuse-first: scans touched records for a parked
- * DS_FREE block whose capacity fits the ALIGNED size, and only then falls
- * back to a fresh bump allocation at data_head. In both paths the record
- * is marked DS_ALLOCATED, used_allocators is incremented, and *p_alloc_idx
- * receives the record's index. A reused record KEEPS its original capacity;
- * a fresh record gets capacity ds_align_up(size). The scan stops at the
- * first DS_NOT_USED record (compact-prefix invariant, see ds_allocator_t).
+ * Both regions are zeroed, which leaves every record DS_NOT_USED and every
+ * bitmap clear. The arrays are carved in the order and with the rounding
+ * DS_RECORD_STORAGE_SIZE() adds up. Under DS_ENGINE_BUDDY the chunk size is
+ * the allocation cap rounded to a buddy block size. init_magic is left to
+ * the caller.
  *
+ * @pre p_config passes ds_config_valid().
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] p_config Storage and limits of the instance.
+ */
+static void ds_attach_storage(dynostatic_buffer_t *p_ds_buffer, const ds_config_t *p_config);
+
+/**
+ * @brief Assign an allocator record and a memory region for a new block.
+ *
+ * Serves the request reuse-first: asks the instance's placement policy for
+ * a parked DS_FREE block whose capacity fits ds_fit_size(size) (see
+ * ds_fit_find()), and only then falls back to a fresh bump allocation at
+ * data_head. In both paths the record is marked
+ * DS_ALLOCATED, used_allocators is incremented, and *p_alloc_idx receives
+ * the record's index. A reused block is trimmed to ds_fit_size(size) by
+ * ds_split_block(); a fresh record gets capacity ds_fit_size(size) and is
+ * appended to the physical chain as the new tail. Either way
+ * next_fit_offset moves to the end of the placed block.
  *
  * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
  * @param[in] size Requested size in bytes (raw; alignment is applied here).
@@ -105,24 +168,71 @@ static inline void ds_memcpy(void *p_dest, size_t dest_size, const void *p_src,
  *                         ERROR_DS_OK.
  *
  * @retval ERROR_DS_OK Record assigned; *p_alloc_idx identifies it.
- * @retval ERROR_DS_NO_ALLOCATORS Either DS_MAX_ALLOCATION_COUNT blocks are
+ * @retval ERROR_DS_NO_ALLOCATORS Either record_count blocks are
  *                                already live, or every record is occupied
  *                                (live, or parked with too small a
- *                                capacity) and no DS_NOT_USED slot remains
+ *                                capacity) and no DS_NOT_USED record remains
  *                                for a bump allocation.
  * @retval ERROR_DS_NO_MEMORY A record is available but the bump space
  *                            cannot hold the aligned size.
  */
 static ds_err_code_t ds_get_new_allocator(dynostatic_buffer_t *p_ds_buffer, size_t size, size_t *p_alloc_idx);
 
+#if DS_ENGINE != DS_ENGINE_BITMAP
+/**
+ * @brief Bump-allocate a block of @p aligned_size bytes at data_head, on a
+ *        DS_NOT_USED record, without looking at the free lists.
+ *
+ * The second half of ds_get_new_allocator(), also used by ds_reserve() to
+ * place a block where its surplus can return straight to data_head. Under
+ * DS_ENGINE_BUDDY a whole chunk is carved and split down.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] aligned_size Capacity wanted, already passed through
+ *                         ds_fit_size().
+ * @param[out] p_alloc_idx Index of the assigned record; written only on
+ *                         ERROR_DS_OK.
+ *
+ * @retval ERROR_DS_OK Record assigned; *p_alloc_idx identifies it.
+ * @retval ERROR_DS_NO_ALLOCATORS No DS_NOT_USED record remains.
+ * @retval ERROR_DS_NO_MEMORY The bump space cannot hold the block.
+ */
+static ds_err_code_t ds_carve_fresh(dynostatic_buffer_t *p_ds_buffer, size_t aligned_size, size_t *p_alloc_idx);
+#endif
+
+/**
+ * @brief Assign a record to a new block of @p size bytes starting at an
+ *        address that is a multiple of @p alignment.
+ *
+ * ds_get_new_allocator() for ds_aligned_malloc(): places a block with room
+ * for the worst-case padding, then trims it. The leading padding goes back
+ * to the engine (on a spare record under the chained engines), the trailing
+ * surplus as in ds_shrink_in_place(). Under DS_ENGINE_BUDDY a block of at
+ * least @p alignment bytes needs no padding.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] size Requested size in bytes; the caller has checked that it
+ *                 and its padding fit max_allocation_size.
+ * @param[in] alignment Power of two above the instance's alignment.
+ * @param[out] p_alloc_idx Index of the assigned record; written only on
+ *                         ERROR_DS_OK.
+ *
+ * @retval ERROR_DS_OK Record assigned; its head meets @p alignment.
+ * @retval ERROR_DS_INVALID_ARG Under DS_ENGINE_BUDDY, the arena base does
+ *                              not meet @p alignment.
+ * @retval ERROR_DS_NO_ALLOCATORS No record for the block, or none for its
+ *                                leading padding.
+ * @retval ERROR_DS_NO_MEMORY No region holds the block and its padding.
+ */
+static ds_err_code_t ds_get_aligned_allocator(dynostatic_buffer_t *p_ds_buffer, size_t size, size_t alignment, size_t *p_alloc_idx);
+
 /**
  * @brief Find the allocator record whose live block starts at @p p_memory.
  *
  * Reduces the pointer to an arena offset and matches it against the head
  * of DS_ALLOCATED records. Only exact block starts match: interior
- * pointers, parked DS_FREE blocks and reclaimed addresses do not. The scan
- * stops at the first DS_NOT_USED record (compact-prefix invariant, see
- * ds_allocator_t). The two failure codes are deliberately diagnostic:
+ * pointers, parked DS_FREE blocks and reclaimed addresses do not. The two
+ * failure codes are deliberately diagnostic:
  * outside the arena (foreign pointer, likely an application logic bug)
  * versus inside but not a live block start (double free or pointer
  * arithmetic gone wrong).
@@ -164,13 +274,15 @@ static ds_err_code_t ds_find_allocator_for_memory(const dynostatic_buffer_t *p_d
  * comparison of addresses is the defined-behaviour alternative to a
  * relational comparison of unrelated pointers.
  *
- * RELIANCE ON INVARIANTS (see ds_allocator_t): the scan leans on the
- * gapless-partition invariant — touched records tile [0, data_head)
- * exactly, so once record i does not contain the offset, the offset is
- * >= head[i] + size[i] == head[i + 1]. This makes an explicit
- * "offset >= head" guard provably redundant (it would be an unreachable
- * branch); if a future change (block splitting/coalescing) breaks
- * gaplessness, this scan must be revisited.
+ * The scan visits only DS_ALLOCATED records, taken from allocated_map one
+ * set bit at a time. No "offset >= head" guard is needed: for a block that
+ * starts above the offset, offset - head wraps around to a value far
+ * larger than any capacity and fails the range check on its own.
+ *
+ * With DS_OWNER_MAP enabled the scan is replaced by a single owner_map
+ * load. The map is exact for every granule of a DS_ALLOCATED block, so the
+ * named record is accepted only if it is DS_ALLOCATED and really covers the
+ * offset; anything else means the offset is not inside a live block.
  *
  * @pre p_ds_buffer, p_alloc_idx and p_offset_in_block are non-NULL; the
  *      instance is initialized. p_memory may hold ANY value — NULL,
@@ -193,445 +305,4043 @@ static ds_err_code_t ds_find_allocator_for_memory(const dynostatic_buffer_t *p_d
 static ds_err_code_t ds_find_allocator_containing(const dynostatic_buffer_t *p_ds_buffer, const void *p_memory, size_t *p_alloc_idx, size_t *p_offset_in_block);
 
 /**
- * @brief Round @p size up to the nearest multiple of DS_ALIGNMENT.
+ * @brief Round @p size up to the nearest multiple of the instance's
+ *        alignment (one granule).
  *
  * Power-of-two mask arithmetic — (size + mask) & ~mask — with every operand
  * in size_t from the first operation (MISRA 10.7). Returns size unchanged
- * when it is already a multiple of DS_ALIGNMENT.
+ * when it is already a multiple of the alignment.
  *
- * @pre size <= DS_MAX_ALLOCATION_SIZE: together with the header's
- *      DS_STATIC_ASSERT (DS_MAX_ALLOCATION_SIZE <= SIZE_MAX - DS_ALIGNMENT
- *      + 1) this makes the internal addition overflow-free.
+ * @pre size <= max_allocation_size: the cap lies within an arena no larger
+ *      than DS_MAX_ARENA_SIZE, which keeps the internal addition
+ *      overflow-free.
  *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
  * @param[in] size Size in bytes to align.
  *
- * @return The smallest multiple of DS_ALIGNMENT that is >= size.
+ * @return The smallest multiple of the alignment that is >= size.
  */
-static inline size_t ds_align_up(size_t size);
+static inline size_t ds_align_up(const dynostatic_buffer_t *p_ds_buffer, size_t size);
 
+#if (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
 /**
  * @brief Reclaim the trailing block and cascade through any DS_FREE blocks
  *        directly beneath it, rolling data_head back past all of them.
  *
- * Correctness rests on two invariants of bump allocation: (a) among touched
- * slots, index order equals head order, so the trailing block always lives
- * at the highest touched index; (b) touched slots form a gapless partition
- * of [0, data_head), so after reclaiming slot idx the block ending exactly
- * at the new data_head is always slot idx - 1.
+ * Correctness rests on the physical-chain invariant (see ds_allocator_t):
+ * the blocks tile [0, data_head) in prev_phys/next_phys order, so after
+ * reclaiming the tail the block ending exactly at the new data_head is its
+ * prev_phys neighbour, which becomes the new tail_record.
  *
  * @note Does NOT modify used_allocators: cascaded DS_FREE records were
  *       already discounted at their own ds_free; the caller decrements
- *       exactly once, for the block currently being freed.
+ *       exactly once, for the block currently being freed. Each cascaded
+ *       DS_FREE record is unlinked from its size-class free list and
+ *       discounted from parked_allocators here.
  *
- * @pre allocators[alloc_idx] is the trailing block (head + size == data_head).
+ * @pre alloc_idx is tail_record (head + size == data_head).
  * @pre Block contents were already zeroed by their respective ds_free calls
  *      (when DS_ZERO_ON_FREE is enabled) — this function only clears records.
+ *      The owner map (DS_OWNER_MAP) is deliberately left stale: lowering
+ *      data_head already excludes the reclaimed granules from lookups.
  *
  * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
  * @param[in] alloc_idx Index of the trailing block's allocator.
  */
 static void ds_reclaim_trailing(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx);
+#endif
 
-/*---Static-Function-Implementation---*/
+/**
+ * @brief Release a live block the way ds_free() does, once the caller has
+ *        found its record: zero it under DS_ZERO_ON_FREE, hand its space
+ *        back to the engine and discount it from used_allocators.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Index of a DS_ALLOCATED record.
+ */
+static void ds_release_block(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx);
 
-static inline void ds_memset(void *p_dest, size_t dest_size, uint8_t sign_to_set, size_t size_to_set)
-{
-    DS_ASSERT(p_dest != NULL);
-    DS_ASSERT(size_to_set <= dest_size); /* the destination-size_to_zero guard memset_s adds */
+/**
+ * @brief Shrink a live block in place to @p aligned_size, the way each engine
+ *        does it: surplus zeroed under DS_ZERO_ON_FREE and handed back.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Index of a DS_ALLOCATED record.
+ * @param[in] aligned_size New capacity, from ds_fit_size(); below the
+ *                         current one.
+ */
+static void ds_shrink_in_place(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t aligned_size);
 
-    (void)memset(p_dest, sign_to_set, size_to_set); /* NOLINT(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling) */
+/**
+ * @brief Grow a live block in place to @p aligned_size, if its engine can:
+ *        over the bump space or parked successors for the chained engines,
+ *        over parked upper buddies, or over free granules for the bitmap.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Index of a DS_ALLOCATED record.
+ * @param[in] aligned_size New capacity, from ds_fit_size(); above the
+ *                         current one.
+ *
+ * @return true if the block now has @p aligned_size bytes; false if it is
+ *         unchanged.
+ */
+static bool ds_grow_in_place(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t aligned_size);
 
-    (void)dest_size;
-}
+/**
+ * @brief Set the allocated_map bit of every DS_ALLOCATED record again, after
+ *        ds_free_batch() has cleared some to mark the entries it checked.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ */
+static void ds_restore_allocated_map(dynostatic_buffer_t *p_ds_buffer);
 
-static inline void ds_zero(void *p_dest, size_t dest_size, size_t size_to_zero)
-{
-    ds_memset(p_dest, dest_size, 0u, size_to_zero);
-}
+#if DS_GROUPS == 1u
+/**
+ * @brief Whether any live block carries group tag @p tag.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] tag Group tag to look for.
+ *
+ * @return true if a DS_ALLOCATED record carries @p tag.
+ */
+static bool ds_group_tag_in_use(const dynostatic_buffer_t *p_ds_buffer, uint16_t tag);
+#endif
 
-static inline void ds_memcpy(void *p_dest, size_t dest_size, const void *p_src, size_t size_to_copy)
-{
-    DS_ASSERT(p_dest != NULL);
-    DS_ASSERT(p_src != NULL);
-    DS_ASSERT(size_to_copy <= dest_size); /* the destination-size guard memcpy_s adds */
+/**
+ * @brief Index of the lowest set bit of @p value (count trailing zeros).
+ *
+ * Compiles to a single instruction on GCC/Clang and MSVC; other compilers
+ * get a portable loop.
+ *
+ * @pre value != 0.
+ *
+ * @param[in] value Bitmask to inspect.
+ *
+ * @return Bit index in 0..31.
+ */
+static inline uint32_t ds_lowest_bit(uint32_t value);
 
-    (void)memcpy(p_dest, p_src, size_to_copy); /* NOLINT(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling) */
+/**
+ * @brief Index of the highest set bit of @p value, i.e. floor(log2(value)).
+ *
+ * @pre value != 0.
+ *
+ * @param[in] value Bitmask to inspect.
+ *
+ * @return Bit index in 0..31.
+ */
+static inline uint32_t ds_highest_bit(uint32_t value);
 
-    (void)dest_size;
-}
+/**
+ * @brief Move record @p alloc_idx to @p status, keeping allocated_map and
+ *        parked_map in step with allocation_status.
+ *
+ * Every lifecycle transition goes through here so the state bitmaps, and
+ * the used_bytes total of DS_ALLOCATED capacities (and requested_bytes under
+ * DS_TRACK_REQUESTED), can never drift from the records they mirror.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Index of the record.
+ * @param[in] status New lifecycle state.
+ */
+static inline void ds_set_status(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, ds_allocator_status_t status);
 
-static ds_err_code_t ds_get_new_allocator(dynostatic_buffer_t *p_ds_buffer, size_t size, size_t *p_alloc_idx)
-{
-    /* No need to check params validness (cause of public API implementation it will be dead code). */
-    size_t iter;
+/**
+ * @brief Set the capacity of record @p alloc_idx, keeping used_bytes in step
+ *        when the record is DS_ALLOCATED.
+ *
+ * Parked records change size only while unlinked from their free list, so
+ * they need no bookkeeping here (see ds_free_list_push()).
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Index of the record.
+ * @param[in] capacity New capacity in bytes.
+ */
+static inline void ds_set_capacity(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t capacity);
 
-    if (p_ds_buffer->used_allocators >= DS_MAX_ALLOCATION_COUNT) {
-        return ERROR_DS_NO_ALLOCATORS;
-    }
+#if DS_TRACK_REQUESTED == 1u
+/**
+ * @brief Set the requested size of DS_ALLOCATED record @p alloc_idx, keeping
+ *        requested_bytes in step.
+ *
+ * ds_set_status() drops the value when the record leaves DS_ALLOCATED, so
+ * only allocating and resizing calls need to set it.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Index of a DS_ALLOCATED record.
+ * @param[in] requested Bytes asked for; at most the record's capacity.
+ */
+static inline void ds_set_requested(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t requested);
+#endif
 
-    const size_t aligned_size = ds_align_up(size);
+/**
+ * @brief Size class of a block capacity: floor(log2(capacity / granule)).
+ *
+ * @pre capacity is a non-zero multiple of the granule.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] capacity Physical capacity in bytes.
+ *
+ * @return Size class, a bit of dynostatic_buffer_t::free_class_map.
+ */
+static inline uint32_t ds_size_class(const dynostatic_buffer_t *p_ds_buffer, size_t capacity);
 
-    for (iter = 0u; iter < DS_MAX_ALLOCATION_COUNT; iter++) {
-        if (p_ds_buffer->allocators[iter].allocation_status == DS_FREE) {
-            if (p_ds_buffer->allocators[iter].size >= aligned_size) {
-                p_ds_buffer->allocators[iter].allocation_status = DS_ALLOCATED;
-                p_ds_buffer->used_allocators++;
-                *p_alloc_idx = iter;
-                return ERROR_DS_OK;
-            }
-        } else if (p_ds_buffer->allocators[iter].allocation_status == DS_NOT_USED) {
-            break;
-        } else {
-            /* No action */
-        }
-    }
+/**
+ * @brief Free list a parked block of @p capacity bytes belongs to: its size
+ *        class, refined under DS_ENGINE_TLSF by the DS_TLSF_SL_BITS bits
+ *        below the leading one of its granule count.
+ *
+ * @pre capacity is a non-zero multiple of the granule.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] capacity Physical capacity in bytes.
+ *
+ * @return Index into dynostatic_buffer_t::free_classes.
+ */
+static inline uint32_t ds_free_list_of(const dynostatic_buffer_t *p_ds_buffer, size_t capacity);
 
-    if (iter == DS_MAX_ALLOCATION_COUNT) {
-        return ERROR_DS_NO_ALLOCATORS;
-    }
+/**
+ * @brief Whether free list @p list holds any parked block, read from the
+ *        occupancy bitmaps.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] list Free list index.
+ *
+ * @return true if the list is non-empty.
+ */
+static inline bool ds_free_list_occupied(const dynostatic_buffer_t *p_ds_buffer, uint32_t list);
 
-    if ((DS_BUFFER_MEMORY_SIZE - p_ds_buffer->data_head) < aligned_size) {
-        return ERROR_DS_NO_MEMORY;
-    }
+/**
+ * @brief Record in the occupancy bitmaps that free list @p list became
+ *        non-empty or empty.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] list Free list index.
+ * @param[in] occupied New occupancy of the list.
+ */
+static inline void ds_free_list_mark(dynostatic_buffer_t *p_ds_buffer, uint32_t list, bool occupied);
 
-    p_ds_buffer->allocators[iter].allocation_status = DS_ALLOCATED;
-    p_ds_buffer->allocators[iter].size = aligned_size;
-    p_ds_buffer->allocators[iter].head = p_ds_buffer->data_head;
-    p_ds_buffer->data_head += aligned_size;
-    p_ds_buffer->used_allocators++;
+#if DS_ENGINE != DS_ENGINE_BITMAP
+/**
+ * @brief Largest capacity a reuse can currently hand out whole: the largest
+ *        parked capacity, or under DS_ENGINE_TLSF the capacity of the head
+ *        of the highest non-empty list — exactly what its ds_free_list_find()
+ *        can still serve — or under DS_ENGINE_BUDDY the block size of the
+ *        highest non-empty order. Constant time.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ *
+ * @return Capacity in bytes; 0 when nothing is parked.
+ */
+static size_t ds_largest_reusable(const dynostatic_buffer_t *p_ds_buffer);
 
-    *p_alloc_idx = iter;
+/**
+ * @brief Link a record that has just become DS_FREE into the free list of
+ *        its size class (at the head, so recently freed — cache-warm —
+ *        blocks are reused first).
+ *
+ * Under DS_ENGINE_BUDDY the block's first granule is also pointed at the
+ * record in the owner map, which is how ds_buddy_find() locates it.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Index of the record; its size must be valid.
+ */
+static void ds_free_list_push(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx);
 
-    return ERROR_DS_OK;
-}
+/**
+ * @brief Unlink a DS_FREE record from its size-class free list in O(1).
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Index of a record currently linked into a free list.
+ */
+static void ds_free_list_unlink(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx);
 
-static inline size_t ds_align_up(size_t size)
-{
-    const size_t mask = (size_t)DS_ALIGNMENT - 1u;
-    return (size + mask) & ~mask;
-}
+#if DS_ENGINE == DS_ENGINE_SEGREGATED
+/**
+ * @brief Recompute largest_parked after the block holding it left the free
+ *        lists.
+ *
+ * The largest parked capacity always lives in the highest non-empty size
+ * class, so only that one list is walked. Push and unlink of any other
+ * block keep largest_parked exact in O(1), which makes
+ * ds_get_max_new_allocation_size() a constant-time read.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ */
+static void ds_refresh_largest_parked(dynostatic_buffer_t *p_ds_buffer);
+#endif
 
-static ds_err_code_t ds_find_allocator_for_memory(const dynostatic_buffer_t *p_ds_buffer, const void *p_memory, size_t *p_alloc_idx)
-{
-    size_t offset_in_block;
-    const ds_err_code_t ret = ds_find_allocator_containing(p_ds_buffer, p_memory, p_alloc_idx, &offset_in_block);
-    if ((ERROR_DS_OK == ret) && (0u != offset_in_block)) {
-        return ERROR_DS_ALLOCATOR_NOT_FOUND; /* interior pointer: not a block start */
-    }
-    return ret;
-}
+/**
+ * @brief Find a parked DS_FREE block able to hold @p aligned_size bytes.
+ *
+ * Every block in a class above the request's own class is large enough,
+ * so the lowest such non-empty class is found with one bit scan of
+ * free_class_map and its head is taken — O(1). Only when all of those are
+ * empty is the request's own class walked, since its blocks straddle the
+ * requested size. The result is therefore found whenever ANY parked block
+ * fits, which ds_get_max_new_allocation_size() relies on.
+ *
+ * Under DS_ENGINE_TLSF the walk is replaced by constant-time steps: the
+ * request is rounded up to the next list boundary, the first non-empty
+ * list at or above that is found with two bit scans and its head taken;
+ * failing that, only the head of the request's own list is tried. The
+ * getter mirrors this through ds_largest_reusable().
+ *
+ * Under DS_ENGINE_BUDDY all blocks of an order have one size, so the head
+ * of the lowest non-empty order at or above the request's is taken: an
+ * exact fit, or else the block that needs the fewest halvings.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] aligned_size Requested size, already aligned to a granule.
+ * @param[out] p_alloc_idx Index of the fitting record; written only when
+ *                         true is returned.
+ *
+ * @return true if a fitting parked block exists, false otherwise.
+ */
+static bool ds_free_list_find(const dynostatic_buffer_t *p_ds_buffer, size_t aligned_size, size_t *p_alloc_idx);
 
-static ds_err_code_t ds_find_allocator_containing(const dynostatic_buffer_t *p_ds_buffer, const void *p_memory, size_t *p_alloc_idx, size_t *p_offset_in_block)
-{
-    /* cppcheck-suppress misra-c2012-11.6 ; deviation: integer comparison is the
-     * defined-behaviour alternative to relational comparison of unrelated pointers */
-    const uintptr_t addr = (uintptr_t)p_memory;
-    /* cppcheck-suppress misra-c2012-11.4 ; deviation: as above */
-    const uintptr_t start = (uintptr_t)p_ds_buffer->memory;
+#if DS_ENGINE == DS_ENGINE_SEGREGATED
+/**
+ * @brief Find the smallest parked DS_FREE block able to hold
+ *        @p aligned_size bytes (DS_FIT_BEST).
+ *
+ * A fitting block of the request's own class is smaller than any block of
+ * a higher class, so the own class is searched first and only the lowest
+ * larger non-empty class after it.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] aligned_size Requested size, already aligned to a granule.
+ * @param[out] p_alloc_idx Index of the fitting record; written only when
+ *                         true is returned.
+ *
+ * @return true if a fitting parked block exists, false otherwise.
+ */
+static bool ds_best_fit_find(const dynostatic_buffer_t *p_ds_buffer, size_t aligned_size, size_t *p_alloc_idx);
 
-    if ((addr < start) || ((addr - start) >= (uintptr_t)DS_BUFFER_MEMORY_SIZE)) {
-        return ERROR_DS_MEMORY_OUT_OF_DS;
-    }
+/**
+ * @brief Find the lowest-addressed parked DS_FREE block at or above
+ *        @p from_offset able to hold @p aligned_size bytes, wrapping to the
+ *        lowest-addressed fitting block overall (DS_FIT_FIRST, DS_FIT_NEXT).
+ *
+ * Visits every parked record once through parked_map.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] aligned_size Requested size, already aligned to a granule.
+ * @param[in] from_offset Arena offset where the search starts (0 for first
+ *                        fit).
+ * @param[out] p_alloc_idx Index of the fitting record; written only when
+ *                         true is returned.
+ *
+ * @return true if a fitting parked block exists, false otherwise.
+ */
+static bool ds_address_fit_find(const dynostatic_buffer_t *p_ds_buffer, size_t aligned_size, size_t from_offset, size_t *p_alloc_idx);
+#endif
 
-    const size_t offset = (size_t)(addr - start);
+/**
+ * @brief Find a parked block for @p aligned_size bytes with the instance's
+ *        ds_fit_policy_t.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] aligned_size Requested capacity, a multiple of the granule.
+ * @param[out] p_alloc_idx Index of the chosen record; written only when
+ *                         true is returned.
+ *
+ * @return true if a fitting parked block exists, false otherwise.
+ */
+static bool ds_fit_find(const dynostatic_buffer_t *p_ds_buffer, size_t aligned_size, size_t *p_alloc_idx);
+#endif
 
-    for (size_t iter = 0u; iter < DS_MAX_ALLOCATION_COUNT; iter++) {
-        const ds_allocator_status_t status = p_ds_buffer->allocators[iter].allocation_status;
+/**
+ * @brief Capacity a request of @p size bytes is served with: @p size
+ *        aligned up to a granule and, under DS_FIT_ROUNDED, further up to
+ *        the size grid (clamped to max_allocation_size). Under
+ *        DS_ENGINE_BUDDY, whatever the policy, its buddy block size; under
+ *        DS_ENGINE_BITMAP always the aligned size.
+ *
+ * @pre size <= max_allocation_size.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] size Requested size in bytes.
+ *
+ * @return Capacity in bytes, a multiple of the granule.
+ */
+static size_t ds_fit_size(const dynostatic_buffer_t *p_ds_buffer, size_t size);
 
-        if (DS_NOT_USED == status) {
-            break;
-        }
+/**
+ * @brief Largest request size whose ds_fit_size() does not exceed
+ *        @p capacity — the inverse used by ds_get_max_new_allocation_size().
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] capacity Available capacity, a multiple of the granule no
+ *                     larger than max_allocation_size.
+ *
+ * @return Largest satisfiable request size in bytes.
+ */
+static size_t ds_fit_size_floor(const dynostatic_buffer_t *p_ds_buffer, size_t capacity);
 
-        const size_t offset_in_block = offset - p_ds_buffer->allocators[iter].head;
+/**
+ * @brief Index of the lowest-numbered DS_NOT_USED record.
+ *
+ * A record is spare iff its bit is clear in both allocated_map and
+ * parked_map, so the first spare record is one bit scan over the
+ * complement of their union per 32 records.
+ *
+ * @pre used_allocators + parked_allocators < record_count.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ *
+ * @return Index of a DS_NOT_USED record.
+ */
+static size_t ds_spare_record(const dynostatic_buffer_t *p_ds_buffer);
 
-        if (offset_in_block < p_ds_buffer->allocators[iter].size) {
-            if (DS_ALLOCATED != status) {
-                return ERROR_DS_ALLOCATOR_NOT_FOUND; /* inside a parked DS_FREE block */
-            }
-            *p_alloc_idx = iter;
-            *p_offset_in_block = offset_in_block;
-            return ERROR_DS_OK;
-        }
+#if DS_ENGINE != DS_ENGINE_BITMAP
+/**
+ * @brief Link record @p alloc_idx into the physical chain directly after
+ *        record @p prev_idx, or as the only block when @p prev_idx is
+ *        DS_ALLOC_IDX_NONE. tail_record follows when the new record ends
+ *        the chain.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] prev_idx Physical predecessor, or DS_ALLOC_IDX_NONE if the
+ *                     chain is empty.
+ * @param[in] alloc_idx Record to link; its head must equal the end of
+ *                      prev_idx's block.
+ */
+static void ds_phys_insert_after(dynostatic_buffer_t *p_ds_buffer, size_t prev_idx, size_t alloc_idx);
+
+/**
+ * @brief Remove record @p alloc_idx from the physical chain, joining its
+ *        neighbours. tail_record moves back when the tail is removed.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Record to unlink.
+ */
+static void ds_phys_unlink(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx);
+
+/**
+ * @brief Trim the block of record @p alloc_idx to @p aligned_size bytes,
+ *        parking the remainder as a new DS_FREE block right behind it.
+ *
+ * Without the split a small request would pin the whole capacity of a
+ * large parked block. The split needs a DS_NOT_USED record to describe
+ * the remainder; when every record is taken the block keeps its full
+ * capacity instead (the remainder is then reported as used until free).
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Record to trim; not DS_NOT_USED.
+ * @param[in] aligned_size New capacity, a multiple of the granule no larger
+ *                         than the current one.
+ */
+static void ds_split_block(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t aligned_size);
+
+/**
+ * @brief Absorb the parked block of record @p alloc_idx into the parked
+ *        block physically preceding it, returning @p alloc_idx to
+ *        DS_NOT_USED.
+ *
+ * The predecessor changes size class, so it is re-linked into the free
+ * lists. Contents need no work: under DS_ZERO_ON_FREE both halves were
+ * already zeroed when they were freed.
+ *
+ * @pre alloc_idx and prev_phys[alloc_idx] are both DS_FREE.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Record of the upper of the two blocks.
+ */
+static void ds_merge_into_prev(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx);
+#endif
+
+#if (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
+/**
+ * @brief Give the tail of record @p alloc_idx's block beyond
+ *        @p aligned_size back to the arena, keeping the block in place.
+ *
+ * The cheapest placement that needs no record is tried first: a trailing
+ * block simply lowers data_head, and a block followed by a parked one
+ * extends that neighbour downwards. Otherwise the tail is split off into a
+ * spare record (see ds_split_block()); with none left the block keeps its
+ * capacity. Under DS_ZERO_ON_FREE the returned bytes are zeroed, as if
+ * freed.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Record of a DS_ALLOCATED block.
+ * @param[in] aligned_size New capacity, a multiple of the granule smaller
+ *                         than the current one.
+ */
+static void ds_shrink_block(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t aligned_size);
+
+/**
+ * @brief Grow record @p alloc_idx's block in place to @p aligned_size by
+ *        taking space from the parked blocks physically following it.
+ *
+ * The run of DS_FREE successors is measured first and nothing is touched
+ * unless it covers the whole growth. Fully consumed parked blocks return
+ * their records to DS_NOT_USED; a partly consumed one keeps its record and
+ * simply starts higher, so growth never needs a spare record.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Record of a DS_ALLOCATED, non-trailing block.
+ * @param[in] aligned_size Requested capacity, a multiple of the granule
+ *                         larger than the current one.
+ *
+ * @return true if the block now has @p aligned_size capacity, false if the
+ *         parked successors are too small (state unchanged).
+ */
+static bool ds_grow_into_next(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t aligned_size);
+#endif
+
+#if (DS_COALESCE_ON_FREE == 1u) && (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
+/**
+ * @brief Merge the just-parked block of record @p alloc_idx with its parked
+ *        physical neighbours.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Record of a DS_FREE block.
+ */
+static void ds_coalesce_block(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx);
+#endif
+
+#if DS_OWNER_MAP == 1u
+/**
+ * @brief Record @p alloc_idx as the owner of every granule in
+ *        [first_offset, end_offset).
+ *
+ * The owner map is maintained lazily: it is written whenever a block
+ * becomes DS_ALLOCATED or grows (bump allocation, reuse, in-place growth)
+ * and never cleared. Entries for parked, split-off or reclaimed granules
+ * therefore go stale, which is safe because lookups accept an entry only
+ * if the named record is DS_ALLOCATED and covers the offset — and every
+ * granule of a live block was written by the allocation that claimed it.
+ * This keeps ds_free() and the reclamation cascade free of O(size) map
+ * traffic.
+ *
+ * @pre first_offset and end_offset are multiples of the granule and
+ *      end_offset / granule <= granule_count.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] first_offset Arena offset of the first granule to assign.
+ * @param[in] end_offset Arena offset one past the last granule to assign.
+ * @param[in] alloc_idx Index of the owning record.
+ */
+static void ds_owner_map_assign(dynostatic_buffer_t *p_ds_buffer, size_t first_offset, size_t end_offset, size_t alloc_idx);
+#endif
+
+#if DS_ENGINE == DS_ENGINE_BUDDY
+/**
+ * @brief Buddy block size of a request: a granule times the smallest
+ *        power of two granules holding @p aligned_size.
+ *
+ * @pre aligned_size is a non-zero multiple of the granule, at most
+ *      buddy_chunk_size.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] aligned_size Requested size, already aligned to a granule.
+ *
+ * @return Block size in bytes.
+ */
+static inline size_t ds_buddy_block_size(const dynostatic_buffer_t *p_ds_buffer, size_t aligned_size);
+
+/**
+ * @brief Size of the chunk untouched space yields next: the largest power
+ *        of two granules up to buddy_chunk_size that fits before the
+ *        arena end.
+ *
+ * Chunks are carved in address order, so a full-size chunk starts at a
+ * multiple of buddy_chunk_size and each shorter one near the arena end
+ * starts at a multiple of twice its size. Every chunk is therefore aligned
+ * to its size, and its upper buddy, if any, is a smaller chunk.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ *
+ * @return Chunk size in bytes; 0 when less than a granule is left.
+ */
+static size_t ds_buddy_frontier_chunk(const dynostatic_buffer_t *p_ds_buffer);
+
+/**
+ * @brief Halve record @p alloc_idx's block down to the smallest buddy
+ *        holding @p aligned_size, parking each upper half on the free list
+ *        of its order.
+ *
+ * Every halving needs a spare record for the parked half (see
+ * ds_split_block()); when they run out the block keeps the capacity reached
+ * so far, which is still a buddy block.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Record of a DS_ALLOCATED buddy block.
+ * @param[in] aligned_size Requested capacity, a buddy block size no larger
+ *                         than the current one.
+ */
+static void ds_buddy_split(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t aligned_size);
+
+/**
+ * @brief Record of the parked buddy of a @p size byte block at @p head.
+ *
+ * The buddy starts at head ^ size. Its owner map entry names a record, and
+ * that record is the buddy only if it is DS_FREE and has exactly that head
+ * and size. One load and three compares, no scan of the records.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] head Arena offset of the block, a multiple of @p size.
+ * @param[in] size Block size in bytes, below buddy_chunk_size.
+ * @param[out] p_buddy_idx Record of the buddy; written only when true is
+ *                         returned.
+ *
+ * @return true if the buddy is parked whole, false otherwise.
+ */
+static bool ds_buddy_find(const dynostatic_buffer_t *p_ds_buffer, size_t head, size_t size, size_t *p_buddy_idx);
+
+/**
+ * @brief Park the block of record @p alloc_idx, merge it with its free
+ *        buddies order by order, and reclaim whole free chunks left at the
+ *        tail of the arena.
+ *
+ * Each merge is O(1) (see ds_buddy_find()), and at most
+ * log2(buddy_chunk_size / granule) of them happen. A free block at
+ * the tail is reclaimed only when it is a whole chunk: anything smaller is
+ * the upper half of a live buddy, and lowering data_head to it would leave
+ * untouched space that is not aligned for a full chunk.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Record of a DS_ALLOCATED block.
+ */
+static void ds_buddy_release(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx);
+
+/**
+ * @brief Grow record @p alloc_idx's block in place to @p aligned_size by
+ *        absorbing its upper buddies, doubling once per order.
+ *
+ * Every step needs the block to be the lower half of its next order and
+ * the upper half to be parked whole. All steps are checked before any
+ * state changes, and absorbed records return to DS_NOT_USED.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Record of a DS_ALLOCATED buddy block.
+ * @param[in] aligned_size Requested capacity, a buddy block size larger
+ *                         than the current one.
+ *
+ * @return true if the block now has @p aligned_size capacity, false if a
+ *         buddy on the way is live or split (state unchanged).
+ */
+static bool ds_buddy_grow(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t aligned_size);
+#endif
+
+#if DS_ENGINE == DS_ENGINE_BITMAP
+/**
+ * @brief Word @p word of the granule bitmap, with the bits past the last
+ *        granule read as used so no run reaches beyond the arena.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] word Index of the word, below the granule_map word count.
+ *
+ * @return Bit g set iff granule word * 32 + g is unavailable.
+ */
+static inline uint32_t ds_bitmap_word(const dynostatic_buffer_t *p_ds_buffer, size_t word);
+
+/**
+ * @brief Index of the first granule bitmap word at or after @p word that
+ *        has a free granule.
+ *
+ * A densely packed arena starts with a stretch of full words. With AVX2
+ * eight of them, with SSE4.1 four, are tested per compare; the scalar loop
+ * finishes what the vectors leave over and is all other targets get.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] word Index of the first word to look at.
+ *
+ * @return Index of the word, or the granule_map word count if every word is full.
+ */
+static size_t ds_bitmap_skip_full(const dynostatic_buffer_t *p_ds_buffer, size_t word);
+
+/**
+ * @brief Starts of the runs of @p granules set bits that lie inside
+ *        @p free_bits.
+ *
+ * Bit j of the result is set iff bits j..j + granules - 1 are all set.
+ * Each step ANDs the mask with itself shifted by the run length found so
+ * far, so a run of n takes about log2(n) steps.
+ *
+ * @param[in] free_bits Free granules of one bitmap word.
+ * @param[in] granules Run length, 1..31.
+ *
+ * @return Mask of run starts; 0 if the word holds no such run.
+ */
+static inline uint32_t ds_bitmap_runs_in_word(uint32_t free_bits, size_t granules);
+
+/**
+ * @brief Mask of @p span bits starting at bit @p bit of a bitmap word.
+ *
+ * @pre span >= 1 and bit + span <= 32.
+ *
+ * @param[in] bit Lowest bit of the mask.
+ * @param[in] span Number of bits.
+ *
+ * @return The mask.
+ */
+static inline uint32_t ds_bitmap_mask(size_t bit, size_t span);
+
+/**
+ * @brief Find the lowest-addressed run of @p granules free granules.
+ *
+ * Walks the bitmap once, carrying the length of the free run that reaches
+ * the end of the previous word: a word with a used granule either completes
+ * that run with its low free bits, holds a short run inside it, or starts a
+ * new run with its high free bits. Full words are skipped in bulk while no
+ * run is open.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] granules Run length, at least 1.
+ * @param[out] p_first First granule of the run; written only when true is
+ *                     returned.
+ *
+ * @return true if such a run exists, false otherwise.
+ */
+static bool ds_bitmap_find_run(const dynostatic_buffer_t *p_ds_buffer, size_t granules, size_t *p_first);
+
+/**
+ * @brief Length of the longest run of free granules, the same walk as
+ *        ds_bitmap_find_run() without an early exit.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ *
+ * @return Run length in granules; 0 when the arena is full.
+ */
+static size_t ds_bitmap_largest_run(const dynostatic_buffer_t *p_ds_buffer);
+
+/**
+ * @brief Set or clear the bits of @p count granules starting at granule
+ *        @p first, a word at a time.
+ *
+ * @pre first + count <= granule_count.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] first First granule.
+ * @param[in] count Number of granules.
+ * @param[in] used true to set the bits, false to clear them.
+ */
+static void ds_bitmap_mark(dynostatic_buffer_t *p_ds_buffer, size_t first, size_t count, bool used);
+
+/**
+ * @brief Whether all @p count granules starting at granule @p first are
+ *        free, a word at a time.
+ *
+ * @pre first + count <= granule_count.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] first First granule.
+ * @param[in] count Number of granules.
+ *
+ * @return true if none of them is used.
+ */
+static bool ds_bitmap_range_free(const dynostatic_buffer_t *p_ds_buffer, size_t first, size_t count);
+
+/**
+ * @brief Lower data_head to one past the highest used granule, after the
+ *        block that ended at data_head shrank or was freed.
+ *
+ * Scans the bitmap down from data_head, so the cost is the distance to the
+ * next live block.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ */
+static void ds_bitmap_lower_head(dynostatic_buffer_t *p_ds_buffer);
+
+/**
+ * @brief Change the capacity of record @p alloc_idx's block in place to
+ *        @p aligned_size.
+ *
+ * A shrink clears the surplus granules (zeroing their bytes under
+ * DS_ZERO_ON_FREE) and always succeeds. A grow needs every granule up to
+ * the new end to be free and inside the arena; it then claims them.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Record of a DS_ALLOCATED block.
+ * @param[in] aligned_size New capacity, a non-zero multiple of the granule.
+ *
+ * @return true if the block now has @p aligned_size capacity, false if the
+ *         granules after it are taken (state unchanged).
+ */
+static bool ds_bitmap_resize(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t aligned_size);
+#endif
+
+#if DS_HANDLES == 1u
+/**
+ * @brief Resolve @p handle to the record of its block.
+ *
+ * A handle is current iff its index is in range, the record's handle_map
+ * bit is set and its generation matches: three loads, whatever happened to
+ * the record since the handle was issued.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] handle Handle to resolve.
+ * @param[out] p_alloc_idx Record of the block; written only on success.
+ *
+ * @return true if @p handle names a live handle block, false if it is stale.
+ */
+static bool ds_handle_record(const dynostatic_buffer_t *p_ds_buffer, ds_handle_t handle, size_t *p_alloc_idx);
+
+#if DS_ENGINE != DS_ENGINE_BITMAP
+/**
+ * @brief Exchange the positions of records @p first_idx and @p second_idx in
+ *        the physical chain; tail_record follows. Heads are left to the
+ *        caller.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] first_idx Record on the chain.
+ * @param[in] second_idx Another record on the chain.
+ */
+static void ds_phys_swap(dynostatic_buffer_t *p_ds_buffer, size_t first_idx, size_t second_idx);
+#endif
+
+/**
+ * @brief Move the unlocked handle block of record @p alloc_idx to a lower
+ *        offset, if the engine has one for it (see ds_compact_step()).
+ *
+ * The record keeps its index and capacity; only its head changes, and the
+ * owner map follows. Space the block leaves is zeroed under
+ * DS_ZERO_ON_FREE, as if freed.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] alloc_idx Record of a DS_ALLOCATED handle block.
+ *
+ * @return true if the block moved, false if it is already as low as the
+ *         engine can place it (state unchanged).
+ */
+static bool ds_compact_block(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx);
+#endif
+
+/*---Static-Function-Implementation---*/
+
+static inline void ds_memset(void *p_dest, size_t dest_size, uint8_t sign_to_set, size_t size_to_set)
+{
+    DS_ASSERT(p_dest != NULL);
+    DS_ASSERT(size_to_set <= dest_size); /* the destination-size_to_zero guard memset_s adds */
+
+    (void)memset(p_dest, sign_to_set, size_to_set); /* NOLINT(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling) */
+
+    (void)dest_size;
+}
+
+static inline void ds_zero(void *p_dest, size_t dest_size, size_t size_to_zero)
+{
+    ds_memset(p_dest, dest_size, 0u, size_to_zero);
+}
+
+static inline void ds_memcpy(void *p_dest, size_t dest_size, const void *p_src, size_t size_to_copy)
+{
+    DS_ASSERT(p_dest != NULL);
+    DS_ASSERT(p_src != NULL);
+    DS_ASSERT(size_to_copy <= dest_size); /* the destination-size guard memcpy_s adds */
+
+    (void)memcpy(p_dest, p_src, size_to_copy); /* NOLINT(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling) */
+
+    (void)dest_size;
+}
+
+#if DS_HANDLES == 1u
+static inline void ds_memmove(void *p_dest, size_t dest_size, const void *p_src, size_t size_to_move)
+{
+    DS_ASSERT(p_dest != NULL);
+    DS_ASSERT(p_src != NULL);
+    DS_ASSERT(size_to_move <= dest_size);
+
+    (void)memmove(p_dest, p_src, size_to_move); /* NOLINT(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling) */
+
+    (void)dest_size;
+}
+#endif
+
+static bool ds_config_valid(const ds_config_t *p_config)
+{
+    const size_t alignment = p_config->alignment;
+
+    if ((NULL == p_config->p_memory) || (NULL == p_config->p_records) || (alignment < DS_ALIGNMENT)
+        || (0u != (alignment & (alignment - 1u)))) {
+        return false;
+    }
+
+    /* cppcheck-suppress misra-c2012-11.4 ; deviation: addresses are only tested for alignment */
+    if ((0u != ((uintptr_t)p_config->p_memory & (alignment - 1u)))
+        || (0u != ((uintptr_t)p_config->p_records & (DS_RECORD_STORAGE_ALIGN - 1u)))) {
+        return false;
+    }
+
+    if ((p_config->memory_size < alignment) || (p_config->memory_size > DS_MAX_ARENA_SIZE) || (0u == p_config->record_count)
+        || (p_config->record_count > DS_MAX_RECORD_COUNT) || (0u == p_config->max_allocation_size)
+        || (p_config->max_allocation_size > p_config->memory_size) || (0u != (p_config->max_allocation_size & (alignment - 1u)))) {
+        return false;
+    }
+
+#if DS_ENGINE == DS_ENGINE_BUDDY
+    size_t chunk = alignment;
+
+    while (chunk < p_config->max_allocation_size) {
+        chunk *= 2u;
+    }
+    if (chunk > p_config->memory_size) {
+        return false;
+    }
+#endif
+
+    return p_config->records_size >= DS_RECORD_STORAGE_SIZE(p_config->record_count, p_config->memory_size, alignment);
+}
+
+static void *ds_carve(uint8_t **pp_cursor, size_t bytes)
+{
+    void *const p_array = *pp_cursor;
+
+    *pp_cursor += DS_STORAGE_ROUND(bytes);
+    return p_array;
+}
+
+static void ds_attach_storage(dynostatic_buffer_t *p_ds_buffer, const ds_config_t *p_config)
+{
+    const size_t records = p_config->record_count;
+    const size_t storage_size = DS_RECORD_STORAGE_SIZE(records, p_config->memory_size, p_config->alignment);
+    uint8_t *p_cursor = p_config->p_records;
+    uint8_t shift = 0u;
+
+    while (((size_t)1u << shift) < p_config->alignment) {
+        shift++;
+    }
+
+    p_ds_buffer->memory = p_config->p_memory;
+    p_ds_buffer->memory_size = p_config->memory_size;
+    p_ds_buffer->record_count = records;
+    p_ds_buffer->granule_shift = shift;
+    p_ds_buffer->granule_count = p_config->memory_size >> shift;
+    p_ds_buffer->max_allocation_size = p_config->max_allocation_size;
+#if DS_ENGINE == DS_ENGINE_BUDDY
+    p_ds_buffer->buddy_chunk_size = ds_buddy_block_size(p_ds_buffer, p_config->max_allocation_size);
+#endif
+
+    ds_zero(p_ds_buffer->memory, p_config->memory_size, p_config->memory_size);
+    ds_zero(p_cursor, p_config->records_size, storage_size);
+
+    /* Same order of terms as DS_RECORD_STORAGE_SIZE(); ds_deinit_allocation()
+     * relies on head being the first. */
+    p_ds_buffer->allocators.head = ds_carve(&p_cursor, records * sizeof(ds_offset_t));
+    p_ds_buffer->allocators.size = ds_carve(&p_cursor, records * sizeof(ds_offset_t));
+    p_ds_buffer->allocators.allocation_status = ds_carve(&p_cursor, records);
+    p_ds_buffer->allocators.prev_free = ds_carve(&p_cursor, records * sizeof(ds_alloc_idx_t));
+    p_ds_buffer->allocators.next_free = ds_carve(&p_cursor, records * sizeof(ds_alloc_idx_t));
+    p_ds_buffer->allocators.prev_phys = ds_carve(&p_cursor, records * sizeof(ds_alloc_idx_t));
+    p_ds_buffer->allocators.next_phys = ds_carve(&p_cursor, records * sizeof(ds_alloc_idx_t));
+    p_ds_buffer->allocated_map = ds_carve(&p_cursor, DS_BIT_WORDS(records) * sizeof(uint32_t));
+    p_ds_buffer->parked_map = ds_carve(&p_cursor, DS_BIT_WORDS(records) * sizeof(uint32_t));
+#if DS_HANDLES == 1u
+    p_ds_buffer->allocators.generation = ds_carve(&p_cursor, records * sizeof(uint16_t));
+    p_ds_buffer->allocators.lock_count = ds_carve(&p_cursor, records);
+    p_ds_buffer->handle_map = ds_carve(&p_cursor, DS_BIT_WORDS(records) * sizeof(uint32_t));
+#endif
+#if DS_GROUPS == 1u
+    p_ds_buffer->allocators.group = ds_carve(&p_cursor, records * sizeof(uint16_t));
+#endif
+#if DS_TRACK_REQUESTED == 1u
+    p_ds_buffer->allocators.requested = ds_carve(&p_cursor, records * sizeof(ds_offset_t));
+#endif
+#if DS_OWNER_MAP == 1u
+    p_ds_buffer->owner_map = ds_carve(&p_cursor, p_ds_buffer->granule_count * sizeof(ds_alloc_idx_t));
+#endif
+#if DS_ENGINE == DS_ENGINE_BITMAP
+    p_ds_buffer->granule_map = ds_carve(&p_cursor, DS_BIT_WORDS(p_ds_buffer->granule_count) * sizeof(uint32_t));
+#endif
+    DS_ASSERT((size_t)(p_cursor - (uint8_t *)p_config->p_records) == storage_size);
+
+    p_ds_buffer->data_head = 0;
+    p_ds_buffer->used_allocators = 0;
+    p_ds_buffer->parked_allocators = 0;
+    p_ds_buffer->tail_record = DS_ALLOC_IDX_NONE;
+    p_ds_buffer->fit_policy = (uint8_t)DS_FIT_POLICY;
+    p_ds_buffer->free_class_map = 0;
+    p_ds_buffer->used_bytes = 0;
+#if DS_TRACK_REQUESTED == 1u
+    p_ds_buffer->requested_bytes = 0;
+#endif
+    p_ds_buffer->largest_parked = 0;
+    p_ds_buffer->next_fit_offset = 0;
+#if DS_GROUPS == 1u
+    p_ds_buffer->last_group = 0;
+#endif
+
+    ds_zero(p_ds_buffer->free_classes, sizeof(p_ds_buffer->free_classes), sizeof(p_ds_buffer->free_classes));
+#if DS_ENGINE == DS_ENGINE_TLSF
+    ds_zero(p_ds_buffer->free_sl_map, sizeof(p_ds_buffer->free_sl_map), sizeof(p_ds_buffer->free_sl_map));
+#endif
+}
+
+static ds_err_code_t ds_get_new_allocator(dynostatic_buffer_t *p_ds_buffer, size_t size, size_t *p_alloc_idx)
+{
+    /* No need to check params validness (cause of public API implementation it will be dead code). */
+    size_t iter;
+
+    if (p_ds_buffer->used_allocators >= p_ds_buffer->record_count) {
+        return ERROR_DS_NO_ALLOCATORS;
+    }
+
+    const size_t aligned_size = ds_fit_size(p_ds_buffer, size);
+
+#if DS_ENGINE == DS_ENGINE_BITMAP
+    /* Nothing is ever parked, so every record not live is spare. */
+    size_t first_granule;
+
+    if (!ds_bitmap_find_run(p_ds_buffer, aligned_size >> p_ds_buffer->granule_shift, &first_granule)) {
+        return ERROR_DS_NO_MEMORY;
+    }
+
+    iter = ds_spare_record(p_ds_buffer);
+    ds_set_status(p_ds_buffer, iter, DS_ALLOCATED);
+    ds_set_capacity(p_ds_buffer, iter, aligned_size);
+    p_ds_buffer->allocators.head[iter] = (ds_offset_t)(first_granule << p_ds_buffer->granule_shift);
+    ds_bitmap_mark(p_ds_buffer, first_granule, aligned_size >> p_ds_buffer->granule_shift, true);
+    p_ds_buffer->used_allocators++;
+    p_ds_buffer->next_fit_offset = (size_t)p_ds_buffer->allocators.head[iter] + aligned_size;
+    if (p_ds_buffer->next_fit_offset > p_ds_buffer->data_head) {
+        p_ds_buffer->data_head = p_ds_buffer->next_fit_offset;
+    }
+    ds_owner_map_assign(p_ds_buffer, p_ds_buffer->allocators.head[iter], p_ds_buffer->next_fit_offset, iter);
+#if DS_TRACK_REQUESTED == 1u
+    ds_set_requested(p_ds_buffer, iter, size);
+#endif
+
+    *p_alloc_idx = iter;
+
+    return ERROR_DS_OK;
+#else
+    if (ds_fit_find(p_ds_buffer, aligned_size, &iter)) {
+        ds_free_list_unlink(p_ds_buffer, iter);
+        ds_set_status(p_ds_buffer, iter, DS_ALLOCATED);
+        p_ds_buffer->parked_allocators--;
+        p_ds_buffer->used_allocators++;
+#if DS_ENGINE == DS_ENGINE_BUDDY
+        ds_buddy_split(p_ds_buffer, iter, aligned_size);
+#else
+        ds_split_block(p_ds_buffer, iter, aligned_size);
+#endif
+        p_ds_buffer->next_fit_offset = (size_t)p_ds_buffer->allocators.head[iter] + p_ds_buffer->allocators.size[iter];
+#if DS_OWNER_MAP == 1u
+        ds_owner_map_assign(p_ds_buffer, p_ds_buffer->allocators.head[iter], p_ds_buffer->next_fit_offset, iter);
+#endif
+#if DS_TRACK_REQUESTED == 1u
+        ds_set_requested(p_ds_buffer, iter, size);
+#endif
+        *p_alloc_idx = iter;
+        return ERROR_DS_OK;
+    }
+
+#if DS_TRACK_REQUESTED == 1u
+    const ds_err_code_t ret = ds_carve_fresh(p_ds_buffer, aligned_size, p_alloc_idx);
+    if (ret == ERROR_DS_OK) {
+        ds_set_requested(p_ds_buffer, *p_alloc_idx, size);
+    }
+    return ret;
+#else
+    return ds_carve_fresh(p_ds_buffer, aligned_size, p_alloc_idx);
+#endif
+#endif
+}
+
+#if DS_ENGINE != DS_ENGINE_BITMAP
+static ds_err_code_t ds_carve_fresh(dynostatic_buffer_t *p_ds_buffer, size_t aligned_size, size_t *p_alloc_idx)
+{
+    if ((p_ds_buffer->used_allocators + p_ds_buffer->parked_allocators) == p_ds_buffer->record_count) {
+        return ERROR_DS_NO_ALLOCATORS;
+    }
+
+#if DS_ENGINE == DS_ENGINE_BUDDY
+    const size_t carved_size = ds_buddy_frontier_chunk(p_ds_buffer); /* a whole chunk, split down below */
+
+    if (carved_size < aligned_size) {
+        return ERROR_DS_NO_MEMORY;
+    }
+#else
+    const size_t carved_size = aligned_size;
+
+    if ((p_ds_buffer->memory_size - p_ds_buffer->data_head) < aligned_size) {
+        return ERROR_DS_NO_MEMORY;
+    }
+#endif
+
+    const size_t iter = ds_spare_record(p_ds_buffer);
+    ds_set_status(p_ds_buffer, iter, DS_ALLOCATED);
+    ds_set_capacity(p_ds_buffer, iter, carved_size);
+    p_ds_buffer->allocators.head[iter] = (ds_offset_t)p_ds_buffer->data_head;
+    ds_phys_insert_after(p_ds_buffer, p_ds_buffer->tail_record, iter);
+    p_ds_buffer->data_head += carved_size;
+    p_ds_buffer->used_allocators++;
+#if DS_ENGINE == DS_ENGINE_BUDDY
+    ds_buddy_split(p_ds_buffer, iter, aligned_size);
+#endif
+    p_ds_buffer->next_fit_offset = (size_t)p_ds_buffer->allocators.head[iter] + p_ds_buffer->allocators.size[iter];
+#if DS_OWNER_MAP == 1u
+    ds_owner_map_assign(p_ds_buffer, p_ds_buffer->allocators.head[iter], p_ds_buffer->next_fit_offset, iter);
+#endif
+#if DS_TRACK_REQUESTED == 1u
+    ds_set_requested(p_ds_buffer, iter, aligned_size); /* callers narrow it to the bytes asked for */
+#endif
+
+    *p_alloc_idx = iter;
+
+    return ERROR_DS_OK;
+}
+#endif
+
+static ds_err_code_t ds_get_aligned_allocator(dynostatic_buffer_t *p_ds_buffer, size_t size, size_t alignment, size_t *p_alloc_idx)
+{
+    const size_t aligned_size = ds_fit_size(p_ds_buffer, size);
+    size_t alloc_idx;
+    ds_err_code_t ret;
+
+#if DS_ENGINE == DS_ENGINE_BUDDY
+    /* A buddy lies at a multiple of its own size from the arena base. */
+    /* cppcheck-suppress misra-c2012-11.4 ; deviation: alignment is a property of the address */
+    if (0u != ((uintptr_t)p_ds_buffer->memory & (uintptr_t)(alignment - 1u))) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    ret = ds_get_new_allocator(p_ds_buffer, (size > alignment) ? size : alignment, &alloc_idx);
+    if (ret != ERROR_DS_OK) {
+        return ret;
+    }
+#else
+#if DS_ENGINE != DS_ENGINE_BITMAP
+    const size_t next_fit_offset = p_ds_buffer->next_fit_offset;
+#if DS_COALESCE_ON_FREE == 0u
+    const size_t parked = p_ds_buffer->parked_allocators;
+#endif
+#endif
+
+    ret = ds_get_new_allocator(p_ds_buffer, aligned_size + (alignment - ((size_t)1u << p_ds_buffer->granule_shift)), &alloc_idx);
+    if (ret != ERROR_DS_OK) {
+        return ret;
+    }
+
+    const size_t head = p_ds_buffer->allocators.head[alloc_idx];
+    /* cppcheck-suppress misra-c2012-11.4 ; deviation: alignment is a property of the address */
+    const uintptr_t addr = (uintptr_t)&p_ds_buffer->memory[head];
+    const size_t pad = (size_t)(((addr + (alignment - 1u)) & ~(uintptr_t)(alignment - 1u)) - addr);
+
+    if (pad != 0u) {
+#if DS_ENGINE == DS_ENGINE_BITMAP
+        ds_bitmap_mark(p_ds_buffer, head >> p_ds_buffer->granule_shift, pad >> p_ds_buffer->granule_shift, false);
+        p_ds_buffer->allocators.head[alloc_idx] = (ds_offset_t)(head + pad);
+        ds_set_capacity(p_ds_buffer, alloc_idx, p_ds_buffer->allocators.size[alloc_idx] - pad);
+#else
+        if ((p_ds_buffer->used_allocators + p_ds_buffer->parked_allocators) == p_ds_buffer->record_count) {
+#if DS_COALESCE_ON_FREE == 0u
+            /* A reuse that split its parked block parks as many records as
+             * before, and the remainder is its successor; a bump placement
+             * is the tail. ds_release_block() leaves the split, as in the
+             * ds_malloc_batch() rollback, so join the halves again. */
+            const size_t rest_idx = (parked == p_ds_buffer->parked_allocators) ? p_ds_buffer->allocators.next_phys[alloc_idx]
+                                                                               : DS_ALLOC_IDX_NONE;
+#endif
+            ds_release_block(p_ds_buffer, alloc_idx);
+#if DS_COALESCE_ON_FREE == 0u
+            if (DS_ALLOC_IDX_NONE != rest_idx) {
+                ds_merge_into_prev(p_ds_buffer, rest_idx);
+            }
+#endif
+            p_ds_buffer->next_fit_offset = next_fit_offset;
+            return ERROR_DS_NO_ALLOCATORS; /* nothing could describe the padding */
+        }
+
+        /* Split the padding off the front: the record keeps it and is
+         * released, and the remainder split behind it becomes the block. */
+        const size_t pad_idx = alloc_idx;
+
+        ds_split_block(p_ds_buffer, pad_idx, pad);
+        alloc_idx = p_ds_buffer->allocators.next_phys[pad_idx];
+        ds_free_list_unlink(p_ds_buffer, alloc_idx);
+        ds_set_status(p_ds_buffer, alloc_idx, DS_ALLOCATED);
+        p_ds_buffer->parked_allocators--;
+        p_ds_buffer->used_allocators++;
+#if DS_OWNER_MAP == 1u
+        ds_owner_map_assign(p_ds_buffer, head + pad, head + pad + p_ds_buffer->allocators.size[alloc_idx], alloc_idx);
+#endif
+        ds_release_block(p_ds_buffer, pad_idx); /* parked, or merged into a parked predecessor */
+#endif
+    }
+#endif
+
+    if (aligned_size < p_ds_buffer->allocators.size[alloc_idx]) {
+        ds_shrink_in_place(p_ds_buffer, alloc_idx, aligned_size);
+    }
+#if DS_TRACK_REQUESTED == 1u
+    ds_set_requested(p_ds_buffer, alloc_idx, size);
+#endif
+
+    *p_alloc_idx = alloc_idx;
+    return ERROR_DS_OK;
+}
+
+static inline size_t ds_align_up(const dynostatic_buffer_t *p_ds_buffer, size_t size)
+{
+    const size_t mask = ((size_t)1u << p_ds_buffer->granule_shift) - 1u;
+    return (size + mask) & ~mask;
+}
+
+static ds_err_code_t ds_find_allocator_for_memory(const dynostatic_buffer_t *p_ds_buffer, const void *p_memory, size_t *p_alloc_idx)
+{
+    size_t offset_in_block;
+    const ds_err_code_t ret = ds_find_allocator_containing(p_ds_buffer, p_memory, p_alloc_idx, &offset_in_block);
+    if ((ERROR_DS_OK == ret) && (0u != offset_in_block)) {
+        return ERROR_DS_ALLOCATOR_NOT_FOUND; /* interior pointer: not a block start */
+    }
+    return ret;
+}
+
+static ds_err_code_t ds_find_allocator_containing(const dynostatic_buffer_t *p_ds_buffer, const void *p_memory, size_t *p_alloc_idx, size_t *p_offset_in_block)
+{
+    /* cppcheck-suppress misra-c2012-11.6 ; deviation: integer comparison is the
+     * defined-behaviour alternative to relational comparison of unrelated pointers */
+    const uintptr_t addr = (uintptr_t)p_memory;
+    /* cppcheck-suppress misra-c2012-11.4 ; deviation: as above */
+    const uintptr_t start = (uintptr_t)p_ds_buffer->memory;
+
+    if ((addr < start) || ((addr - start) >= (uintptr_t)p_ds_buffer->memory_size)) {
+        return ERROR_DS_MEMORY_OUT_OF_DS;
+    }
+
+    const size_t offset = (size_t)(addr - start);
+
+#if DS_OWNER_MAP == 1u
+    if (offset >= p_ds_buffer->data_head) {
+        return ERROR_DS_ALLOCATOR_NOT_FOUND; /* never-touched or reclaimed space */
+    }
+
+    const size_t owner = p_ds_buffer->owner_map[offset >> p_ds_buffer->granule_shift];
+    const size_t owner_offset = offset - p_ds_buffer->allocators.head[owner];
+
+    if ((DS_ALLOCATED != p_ds_buffer->allocators.allocation_status[owner])
+        || (owner_offset >= p_ds_buffer->allocators.size[owner])) {
+        return ERROR_DS_ALLOCATOR_NOT_FOUND; /* stale entry: parked or split-off space */
+    }
+    *p_alloc_idx = owner;
+    *p_offset_in_block = owner_offset;
+    return ERROR_DS_OK;
+#else
+    for (size_t word = 0u; word < DS_BIT_WORDS(p_ds_buffer->record_count); word++) {
+        uint32_t live = p_ds_buffer->allocated_map[word];
+
+        while (0u != live) {
+            const size_t iter = (word * 32u) + ds_lowest_bit(live);
+            const size_t offset_in_block = offset - p_ds_buffer->allocators.head[iter];
+
+            if (offset_in_block < p_ds_buffer->allocators.size[iter]) {
+                *p_alloc_idx = iter;
+                *p_offset_in_block = offset_in_block;
+                return ERROR_DS_OK;
+            }
+            live &= live - 1u; /* clear the visited bit */
+        }
+    }
+
+    return ERROR_DS_ALLOCATOR_NOT_FOUND; /* parked, reclaimed or never-allocated space */
+#endif
+}
+
+#if (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
+static void ds_reclaim_trailing(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx)
+{
+    size_t idx = alloc_idx;
+    bool cascade = true;
+
+    DS_ASSERT(idx == p_ds_buffer->tail_record);
+
+    while (cascade) {
+        p_ds_buffer->data_head = p_ds_buffer->allocators.head[idx];
+        ds_phys_unlink(p_ds_buffer, idx);
+        ds_set_status(p_ds_buffer, idx, DS_NOT_USED);
+        p_ds_buffer->allocators.head[idx] = 0u;
+        p_ds_buffer->allocators.size[idx] = 0u;
+
+        idx = p_ds_buffer->tail_record;
+        if ((DS_ALLOC_IDX_NONE == idx) || (DS_FREE != p_ds_buffer->allocators.allocation_status[idx])) {
+            cascade = false;
+        } else {
+            ds_free_list_unlink(p_ds_buffer, idx);
+            p_ds_buffer->parked_allocators--;
+        }
+    }
+}
+#endif
+
+static void ds_release_block(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx)
+{
+    const size_t head = p_ds_buffer->allocators.head[alloc_idx];
+    const size_t size = p_ds_buffer->allocators.size[alloc_idx];
+
+#if DS_ZERO_ON_FREE == 1u
+    ds_zero(&p_ds_buffer->memory[head], p_ds_buffer->memory_size - head, size);
+#endif
+
+#if DS_ENGINE == DS_ENGINE_BUDDY
+    (void)head; /* only read above: buddy release works on whole chunks, not on data_head */
+    (void)size;
+    ds_buddy_release(p_ds_buffer, alloc_idx);
+#elif DS_ENGINE == DS_ENGINE_BITMAP
+    ds_bitmap_mark(p_ds_buffer, head >> p_ds_buffer->granule_shift, size >> p_ds_buffer->granule_shift, false);
+    ds_set_status(p_ds_buffer, alloc_idx, DS_NOT_USED);
+    p_ds_buffer->allocators.head[alloc_idx] = 0u;
+    p_ds_buffer->allocators.size[alloc_idx] = 0u;
+    if ((head + size) == p_ds_buffer->data_head) {
+        ds_bitmap_lower_head(p_ds_buffer);
+    }
+#else
+    if ((head + size) == p_ds_buffer->data_head) {
+        ds_reclaim_trailing(p_ds_buffer, alloc_idx);
+    } else {
+        ds_set_status(p_ds_buffer, alloc_idx, DS_FREE);
+        ds_free_list_push(p_ds_buffer, alloc_idx);
+        p_ds_buffer->parked_allocators++;
+#if DS_COALESCE_ON_FREE == 1u
+        ds_coalesce_block(p_ds_buffer, alloc_idx);
+#endif
+    }
+#endif
+
+    p_ds_buffer->used_allocators--;
+}
+
+static void ds_shrink_in_place(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t aligned_size)
+{
+#if DS_ENGINE == DS_ENGINE_BUDDY
+#if DS_ZERO_ON_FREE == 1u
+    const size_t surplus = p_ds_buffer->allocators.head[alloc_idx] + aligned_size;
+    ds_zero(&p_ds_buffer->memory[surplus], p_ds_buffer->memory_size - surplus, p_ds_buffer->allocators.size[alloc_idx] - aligned_size);
+#endif
+    ds_buddy_split(p_ds_buffer, alloc_idx, aligned_size); /* upper halves parked */
+#elif DS_ENGINE == DS_ENGINE_BITMAP
+    (void)ds_bitmap_resize(p_ds_buffer, alloc_idx, aligned_size); /* surplus granules cleared */
+#else
+    ds_shrink_block(p_ds_buffer, alloc_idx, aligned_size); /* in place, surplus returned */
+#endif
+}
+
+static bool ds_grow_in_place(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t aligned_size)
+{
+#if DS_ENGINE == DS_ENGINE_BUDDY
+    /* A buddy block only grows over its parked upper buddies. */
+    return ds_buddy_grow(p_ds_buffer, alloc_idx, aligned_size);
+#elif DS_ENGINE == DS_ENGINE_BITMAP
+    /* Any block grows in place while the granules after it are free. */
+    return ds_bitmap_resize(p_ds_buffer, alloc_idx, aligned_size);
+#else
+    const size_t head = p_ds_buffer->allocators.head[alloc_idx];
+    const size_t capacity = p_ds_buffer->allocators.size[alloc_idx];
+
+    /* Trailing-block fast path: grow in place by advancing the bump head. */
+    if (((head + capacity) == p_ds_buffer->data_head)
+        && ((p_ds_buffer->memory_size - head) >= aligned_size)) {
+        p_ds_buffer->data_head = head + aligned_size;
+        ds_set_capacity(p_ds_buffer, alloc_idx, aligned_size);
+#if DS_OWNER_MAP == 1u
+        ds_owner_map_assign(p_ds_buffer, head + capacity, head + aligned_size, alloc_idx);
+#endif
+        return true;
+    }
+
+    /* Interior block: grow in place over parked successors when they suffice. */
+    return ds_grow_into_next(p_ds_buffer, alloc_idx, aligned_size);
+#endif
+}
+
+static void ds_restore_allocated_map(dynostatic_buffer_t *p_ds_buffer)
+{
+    for (size_t iter = 0u; iter < p_ds_buffer->record_count; iter++) {
+        if (DS_ALLOCATED == p_ds_buffer->allocators.allocation_status[iter]) {
+            p_ds_buffer->allocated_map[iter / 32u] |= (uint32_t)1u << (iter % 32u);
+        }
+    }
+}
+
+#if DS_GROUPS == 1u
+static bool ds_group_tag_in_use(const dynostatic_buffer_t *p_ds_buffer, uint16_t tag)
+{
+    for (size_t word = 0u; word < DS_BIT_WORDS(p_ds_buffer->record_count); word++) {
+        uint32_t live = p_ds_buffer->allocated_map[word];
+
+        while (0u != live) {
+            if (tag == p_ds_buffer->allocators.group[(word * 32u) + ds_lowest_bit(live)]) {
+                return true;
+            }
+            live &= live - 1u; /* clear the visited bit */
+        }
+    }
+    return false;
+}
+#endif
+
+static inline uint32_t ds_lowest_bit(uint32_t value)
+{
+    DS_ASSERT(value != 0u);
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_ctz(value);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    (void)_BitScanForward(&index, value);
+    return (uint32_t)index;
+#else
+    uint32_t index = 0u;
+    while (((value >> index) & 1u) == 0u) {
+        index++;
+    }
+    return index;
+#endif
+}
+
+static inline uint32_t ds_highest_bit(uint32_t value)
+{
+    DS_ASSERT(value != 0u);
+#if defined(__GNUC__) || defined(__clang__)
+    return 31u - (uint32_t)__builtin_clz(value);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    (void)_BitScanReverse(&index, value);
+    return (uint32_t)index;
+#else
+    uint32_t index = 31u;
+    while (((value >> index) & 1u) == 0u) {
+        index--;
+    }
+    return index;
+#endif
+}
+
+static inline void ds_set_status(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, ds_allocator_status_t status)
+{
+    const size_t word = alloc_idx / 32u;
+    const uint32_t bit = (uint32_t)1u << (alloc_idx % 32u);
+
+    if (DS_ALLOCATED == p_ds_buffer->allocators.allocation_status[alloc_idx]) {
+        p_ds_buffer->used_bytes -= p_ds_buffer->allocators.size[alloc_idx];
+#if DS_TRACK_REQUESTED == 1u
+        p_ds_buffer->requested_bytes -= p_ds_buffer->allocators.requested[alloc_idx];
+        p_ds_buffer->allocators.requested[alloc_idx] = 0u;
+#endif
+    }
+    if (DS_ALLOCATED == status) {
+        p_ds_buffer->used_bytes += p_ds_buffer->allocators.size[alloc_idx];
+    }
+
+    p_ds_buffer->allocators.allocation_status[alloc_idx] = (uint8_t)status;
+    p_ds_buffer->allocated_map[word] &= ~bit;
+    p_ds_buffer->parked_map[word] &= ~bit;
+
+    if (DS_ALLOCATED == status) {
+        p_ds_buffer->allocated_map[word] |= bit;
+#if DS_GROUPS == 1u
+        p_ds_buffer->allocators.group[alloc_idx] = 0u; /* ds_group_malloc() tags it afterwards */
+#endif
+    } else if (DS_FREE == status) {
+        p_ds_buffer->parked_map[word] |= bit;
+    } else {
+        /* DS_NOT_USED: neither map */
+    }
+}
+
+static inline void ds_set_capacity(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t capacity)
+{
+    if (DS_ALLOCATED == p_ds_buffer->allocators.allocation_status[alloc_idx]) {
+        p_ds_buffer->used_bytes = (p_ds_buffer->used_bytes - p_ds_buffer->allocators.size[alloc_idx]) + capacity;
+    }
+    p_ds_buffer->allocators.size[alloc_idx] = (ds_offset_t)capacity;
+}
+
+#if DS_TRACK_REQUESTED == 1u
+static inline void ds_set_requested(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t requested)
+{
+    DS_ASSERT((DS_ALLOCATED == p_ds_buffer->allocators.allocation_status[alloc_idx])
+              && (requested <= p_ds_buffer->allocators.size[alloc_idx]));
+    p_ds_buffer->requested_bytes = (p_ds_buffer->requested_bytes - p_ds_buffer->allocators.requested[alloc_idx]) + requested;
+    p_ds_buffer->allocators.requested[alloc_idx] = (ds_offset_t)requested;
+}
+#endif
+
+static inline uint32_t ds_size_class(const dynostatic_buffer_t *p_ds_buffer, size_t capacity)
+{
+    DS_ASSERT(((capacity >> p_ds_buffer->granule_shift) != 0u) && ((capacity & (((size_t)1u << p_ds_buffer->granule_shift) - 1u)) == 0u));
+    return ds_highest_bit((uint32_t)(capacity >> p_ds_buffer->granule_shift));
+}
+
+static inline uint32_t ds_free_list_of(const dynostatic_buffer_t *p_ds_buffer, size_t capacity)
+{
+#if DS_ENGINE == DS_ENGINE_TLSF
+    const uint32_t granules = (uint32_t)(capacity >> p_ds_buffer->granule_shift);
+    const uint32_t size_class = ds_size_class(p_ds_buffer, capacity);
+    uint32_t second_level;
+
+    /* Below 2^DS_TLSF_SL_BITS granules a class has fewer sizes than lists,
+     * so sizes spread over every other list and each list is exact. */
+    if (size_class >= DS_TLSF_SL_BITS) {
+        second_level = (granules >> (size_class - DS_TLSF_SL_BITS)) & (DS_TLSF_SL_COUNT - 1u);
+    } else {
+        second_level = (granules << (DS_TLSF_SL_BITS - size_class)) & (DS_TLSF_SL_COUNT - 1u);
+    }
+    return (size_class << DS_TLSF_SL_BITS) | second_level;
+#else
+    return ds_size_class(p_ds_buffer, capacity);
+#endif
+}
+
+static inline bool ds_free_list_occupied(const dynostatic_buffer_t *p_ds_buffer, uint32_t list)
+{
+#if DS_ENGINE == DS_ENGINE_TLSF
+    return ((p_ds_buffer->free_sl_map[list >> DS_TLSF_SL_BITS] >> (list & (DS_TLSF_SL_COUNT - 1u))) & 1u) != 0u;
+#else
+    return ((p_ds_buffer->free_class_map >> list) & 1u) != 0u;
+#endif
+}
+
+static inline void ds_free_list_mark(dynostatic_buffer_t *p_ds_buffer, uint32_t list, bool occupied)
+{
+#if DS_ENGINE == DS_ENGINE_TLSF
+    const uint32_t size_class = list >> DS_TLSF_SL_BITS;
+    const uint32_t list_bit = (uint32_t)1u << (list & (DS_TLSF_SL_COUNT - 1u));
+
+    if (occupied) {
+        p_ds_buffer->free_sl_map[size_class] |= list_bit;
+        p_ds_buffer->free_class_map |= (uint32_t)1u << size_class;
+    } else {
+        p_ds_buffer->free_sl_map[size_class] &= ~list_bit;
+        if (0u == p_ds_buffer->free_sl_map[size_class]) {
+            p_ds_buffer->free_class_map &= ~((uint32_t)1u << size_class);
+        }
+    }
+#else
+    if (occupied) {
+        p_ds_buffer->free_class_map |= (uint32_t)1u << list;
+    } else {
+        p_ds_buffer->free_class_map &= ~((uint32_t)1u << list);
+    }
+#endif
+}
+
+#if DS_ENGINE != DS_ENGINE_BITMAP
+static void ds_free_list_push(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx)
+{
+    ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    const uint32_t list = ds_free_list_of(p_ds_buffer, p_records->size[alloc_idx]);
+
+    p_records->prev_free[alloc_idx] = DS_ALLOC_IDX_NONE;
+    p_records->next_free[alloc_idx] = DS_ALLOC_IDX_NONE;
+
+    if (ds_free_list_occupied(p_ds_buffer, list)) {
+        p_records->next_free[alloc_idx] = p_ds_buffer->free_classes[list];
+        p_records->prev_free[p_records->next_free[alloc_idx]] = (ds_alloc_idx_t)alloc_idx;
+    }
+
+    p_ds_buffer->free_classes[list] = (ds_alloc_idx_t)alloc_idx;
+    ds_free_list_mark(p_ds_buffer, list, true);
+
+#if DS_ENGINE == DS_ENGINE_SEGREGATED
+    if (p_records->size[alloc_idx] > p_ds_buffer->largest_parked) {
+        p_ds_buffer->largest_parked = p_records->size[alloc_idx];
+    }
+#elif DS_ENGINE == DS_ENGINE_BUDDY
+    p_ds_buffer->owner_map[p_records->head[alloc_idx] >> p_ds_buffer->granule_shift] = (ds_alloc_idx_t)alloc_idx;
+#endif
+}
+
+static void ds_free_list_unlink(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx)
+{
+    ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    const uint32_t list = ds_free_list_of(p_ds_buffer, p_records->size[alloc_idx]);
+    const ds_alloc_idx_t prev = p_records->prev_free[alloc_idx];
+    const ds_alloc_idx_t next = p_records->next_free[alloc_idx];
+
+    if (DS_ALLOC_IDX_NONE != prev) {
+        p_records->next_free[prev] = next;
+    } else {
+        p_ds_buffer->free_classes[list] = next;
+        if (DS_ALLOC_IDX_NONE == next) {
+            ds_free_list_mark(p_ds_buffer, list, false);
+        }
+    }
+
+    if (DS_ALLOC_IDX_NONE != next) {
+        p_records->prev_free[next] = prev;
+    }
+
+#if DS_ENGINE == DS_ENGINE_SEGREGATED
+    if (p_records->size[alloc_idx] == p_ds_buffer->largest_parked) {
+        ds_refresh_largest_parked(p_ds_buffer);
+    }
+#endif
+}
+
+static size_t ds_largest_reusable(const dynostatic_buffer_t *p_ds_buffer)
+{
+#if DS_ENGINE == DS_ENGINE_TLSF
+    if (0u == p_ds_buffer->free_class_map) {
+        return 0u;
+    }
+
+    const uint32_t size_class = ds_highest_bit(p_ds_buffer->free_class_map);
+    const uint32_t list = (size_class << DS_TLSF_SL_BITS) | ds_highest_bit(p_ds_buffer->free_sl_map[size_class]);
+    return p_ds_buffer->allocators.size[p_ds_buffer->free_classes[list]];
+#elif DS_ENGINE == DS_ENGINE_BUDDY
+    if (0u == p_ds_buffer->free_class_map) {
+        return 0u;
+    }
+    return (size_t)1u << (p_ds_buffer->granule_shift + ds_highest_bit(p_ds_buffer->free_class_map));
+#else
+    return p_ds_buffer->largest_parked;
+#endif
+}
+
+#if DS_ENGINE == DS_ENGINE_SEGREGATED
+static void ds_refresh_largest_parked(dynostatic_buffer_t *p_ds_buffer)
+{
+    size_t largest = 0u;
+
+    if (0u != p_ds_buffer->free_class_map) {
+        const uint32_t top_class = ds_highest_bit(p_ds_buffer->free_class_map);
+        for (size_t iter = p_ds_buffer->free_classes[top_class]; iter != DS_ALLOC_IDX_NONE;
+             iter = p_ds_buffer->allocators.next_free[iter]) {
+            if (p_ds_buffer->allocators.size[iter] > largest) {
+                largest = p_ds_buffer->allocators.size[iter];
+            }
+        }
+    }
+    p_ds_buffer->largest_parked = largest;
+}
+#endif
+
+#if DS_ENGINE == DS_ENGINE_TLSF
+static bool ds_free_list_find(const dynostatic_buffer_t *p_ds_buffer, size_t aligned_size, size_t *p_alloc_idx)
+{
+    const uint32_t own_list = ds_free_list_of(p_ds_buffer, aligned_size);
+    const uint32_t order = ds_size_class(p_ds_buffer, aligned_size);
+    size_t search_size = aligned_size;
+
+    /* Round up to the next list boundary, so every block of the lists
+     * searched below fits. Exact lists need no rounding. */
+    if (order > DS_TLSF_SL_BITS) {
+        search_size += (((size_t)1u << (order - DS_TLSF_SL_BITS)) - 1u) << p_ds_buffer->granule_shift;
+    }
+
+    const uint32_t search_list = ds_free_list_of(p_ds_buffer, search_size);
+    uint32_t size_class = search_list >> DS_TLSF_SL_BITS;
+    uint32_t lists = p_ds_buffer->free_sl_map[size_class] & ~(((uint32_t)1u << (search_list & (DS_TLSF_SL_COUNT - 1u))) - 1u);
+
+    if ((0u == lists) && (size_class < (DS_SIZE_CLASS_COUNT - 1u))) {
+        const uint32_t classes = p_ds_buffer->free_class_map & ~(((uint32_t)1u << (size_class + 1u)) - 1u);
+        if (0u != classes) {
+            size_class = ds_lowest_bit(classes);
+            lists = p_ds_buffer->free_sl_map[size_class];
+        }
+    }
+
+    if (0u != lists) {
+        *p_alloc_idx = p_ds_buffer->free_classes[(size_class << DS_TLSF_SL_BITS) | ds_lowest_bit(lists)];
+        return true;
+    }
+
+    /* The own list straddles the request; only its head is worth one look. */
+    if (ds_free_list_occupied(p_ds_buffer, own_list)
+        && (p_ds_buffer->allocators.size[p_ds_buffer->free_classes[own_list]] >= aligned_size)) {
+        *p_alloc_idx = p_ds_buffer->free_classes[own_list];
+        return true;
+    }
+
+    return false;
+}
+#elif DS_ENGINE == DS_ENGINE_BUDDY
+static bool ds_free_list_find(const dynostatic_buffer_t *p_ds_buffer, size_t aligned_size, size_t *p_alloc_idx)
+{
+    const uint32_t orders = p_ds_buffer->free_class_map & ~(((uint32_t)1u << ds_size_class(p_ds_buffer, aligned_size)) - 1u);
+
+    if (0u == orders) {
+        return false;
+    }
+
+    *p_alloc_idx = p_ds_buffer->free_classes[ds_lowest_bit(orders)];
+    return true;
+}
+#else
+static bool ds_free_list_find(const dynostatic_buffer_t *p_ds_buffer, size_t aligned_size, size_t *p_alloc_idx)
+{
+    const uint32_t own_class = ds_size_class(p_ds_buffer, aligned_size);
+    uint32_t fitting = 0u;
+
+    if (own_class < (DS_SIZE_CLASS_COUNT - 1u)) {
+        fitting = p_ds_buffer->free_class_map & ~(((uint32_t)1u << (own_class + 1u)) - 1u);
+    }
+
+    if (0u != fitting) {
+        *p_alloc_idx = p_ds_buffer->free_classes[ds_lowest_bit(fitting)];
+        return true;
+    }
+
+    if ((p_ds_buffer->free_class_map & ((uint32_t)1u << own_class)) != 0u) {
+        for (size_t iter = p_ds_buffer->free_classes[own_class]; iter != DS_ALLOC_IDX_NONE;
+             iter = p_ds_buffer->allocators.next_free[iter]) {
+            if (p_ds_buffer->allocators.size[iter] >= aligned_size) {
+                *p_alloc_idx = iter;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+#endif
+
+#if DS_ENGINE == DS_ENGINE_SEGREGATED
+static bool ds_best_fit_find(const dynostatic_buffer_t *p_ds_buffer, size_t aligned_size, size_t *p_alloc_idx)
+{
+    const ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    const uint32_t own_class = ds_size_class(p_ds_buffer, aligned_size);
+    uint32_t candidates = p_ds_buffer->free_class_map & ~(((uint32_t)1u << own_class) - 1u);
+
+    /* The own class may hold no fitting block at all; then the lowest larger
+     * class is next, and all of its blocks fit. */
+    while (0u != candidates) {
+        const uint32_t size_class = ds_lowest_bit(candidates);
+        size_t best = DS_ALLOC_IDX_NONE;
+
+        for (size_t iter = p_ds_buffer->free_classes[size_class]; iter != DS_ALLOC_IDX_NONE; iter = p_records->next_free[iter]) {
+            if ((p_records->size[iter] >= aligned_size)
+                && ((DS_ALLOC_IDX_NONE == best) || (p_records->size[iter] < p_records->size[best]))) {
+                best = iter;
+            }
+        }
+
+        if (DS_ALLOC_IDX_NONE != best) {
+            *p_alloc_idx = best;
+            return true;
+        }
+        candidates &= candidates - 1u;
+    }
+
+    return false;
+}
+
+static bool ds_address_fit_find(const dynostatic_buffer_t *p_ds_buffer, size_t aligned_size, size_t from_offset, size_t *p_alloc_idx)
+{
+    const ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    size_t ahead = DS_ALLOC_IDX_NONE;   /* lowest fitting head >= from_offset */
+    size_t wrapped = DS_ALLOC_IDX_NONE; /* lowest fitting head overall */
+
+    for (size_t word = 0u; word < DS_BIT_WORDS(p_ds_buffer->record_count); word++) {
+        uint32_t parked = p_ds_buffer->parked_map[word];
+
+        while (0u != parked) {
+            const size_t iter = (word * 32u) + ds_lowest_bit(parked);
+            const size_t head = p_records->head[iter];
+
+            if (p_records->size[iter] >= aligned_size) {
+                if ((DS_ALLOC_IDX_NONE == wrapped) || (head < p_records->head[wrapped])) {
+                    wrapped = iter;
+                }
+                if ((head >= from_offset) && ((DS_ALLOC_IDX_NONE == ahead) || (head < p_records->head[ahead]))) {
+                    ahead = iter;
+                }
+            }
+            parked &= parked - 1u; /* clear the visited bit */
+        }
+    }
+
+    if (DS_ALLOC_IDX_NONE != ahead) {
+        *p_alloc_idx = ahead;
+        return true;
+    }
+    if (DS_ALLOC_IDX_NONE != wrapped) {
+        *p_alloc_idx = wrapped;
+        return true;
+    }
+    return false;
+}
+
+#endif
+
+static bool ds_fit_find(const dynostatic_buffer_t *p_ds_buffer, size_t aligned_size, size_t *p_alloc_idx)
+{
+#if DS_ENGINE != DS_ENGINE_SEGREGATED
+    return ds_free_list_find(p_ds_buffer, aligned_size, p_alloc_idx); /* placement is the engine's own */
+#else
+    switch (p_ds_buffer->fit_policy) {
+    case DS_FIT_FIRST:
+        return ds_address_fit_find(p_ds_buffer, aligned_size, 0u, p_alloc_idx);
+    case DS_FIT_BEST:
+        return ds_best_fit_find(p_ds_buffer, aligned_size, p_alloc_idx);
+    case DS_FIT_NEXT:
+        return ds_address_fit_find(p_ds_buffer, aligned_size, p_ds_buffer->next_fit_offset, p_alloc_idx);
+    default: /* DS_FIT_SEGREGATED, DS_FIT_ROUNDED */
+        return ds_free_list_find(p_ds_buffer, aligned_size, p_alloc_idx);
+    }
+#endif
+}
+#endif
+
+static size_t ds_fit_size(const dynostatic_buffer_t *p_ds_buffer, size_t size)
+{
+    const size_t aligned_size = ds_align_up(p_ds_buffer, size);
+
+#if DS_ENGINE == DS_ENGINE_BUDDY
+    return ds_buddy_block_size(p_ds_buffer, aligned_size);
+#elif DS_ENGINE == DS_ENGINE_BITMAP
+    return aligned_size;
+#else
+    if (DS_FIT_ROUNDED != p_ds_buffer->fit_policy) {
+        return aligned_size;
+    }
+
+    /* Four grid steps per power of two: below 4 granules every size is a step. */
+    size_t granules = aligned_size >> p_ds_buffer->granule_shift;
+    const uint32_t order = ds_highest_bit((uint32_t)granules);
+
+    if (order >= 2u) {
+        const size_t step = (size_t)1u << (order - 2u);
+        granules = (granules + step - 1u) & ~(step - 1u);
+    }
+
+    const size_t rounded = granules << p_ds_buffer->granule_shift;
+    return (rounded < p_ds_buffer->max_allocation_size) ? rounded : p_ds_buffer->max_allocation_size;
+#endif
+}
+
+static size_t ds_fit_size_floor(const dynostatic_buffer_t *p_ds_buffer, size_t capacity)
+{
+#if (DS_ENGINE == DS_ENGINE_BUDDY) || (DS_ENGINE == DS_ENGINE_BITMAP)
+    (void)p_ds_buffer;
+    return capacity; /* a buddy block size or the cap below the chunk size; any aligned size for the bitmap */
+#else
+    if ((DS_FIT_ROUNDED != p_ds_buffer->fit_policy) || (capacity < ((size_t)1u << p_ds_buffer->granule_shift)) || (capacity >= p_ds_buffer->max_allocation_size)) {
+        return capacity; /* ds_fit_size() is the identity on aligned sizes, or clamps to the cap */
+    }
+
+    size_t granules = capacity >> p_ds_buffer->granule_shift;
+    const uint32_t order = ds_highest_bit((uint32_t)granules);
+
+    if (order >= 2u) {
+        granules &= ~(((size_t)1u << (order - 2u)) - 1u);
+    }
+    return granules << p_ds_buffer->granule_shift;
+#endif
+}
+
+static size_t ds_spare_record(const dynostatic_buffer_t *p_ds_buffer)
+{
+    DS_ASSERT((p_ds_buffer->used_allocators + p_ds_buffer->parked_allocators) < p_ds_buffer->record_count);
+
+    size_t word = 0u;
+    uint32_t spare = ~(p_ds_buffer->allocated_map[0] | p_ds_buffer->parked_map[0]);
+
+    while (0u == spare) {
+        word++;
+        spare = ~(p_ds_buffer->allocated_map[word] | p_ds_buffer->parked_map[word]);
+    }
+
+    /* Bits past record_count read as spare, but the precondition
+     * guarantees a real spare record comes first. */
+    const size_t alloc_idx = (word * 32u) + ds_lowest_bit(spare);
+    DS_ASSERT(alloc_idx < p_ds_buffer->record_count);
+    return alloc_idx;
+}
+
+#if DS_ENGINE != DS_ENGINE_BITMAP
+static void ds_phys_insert_after(dynostatic_buffer_t *p_ds_buffer, size_t prev_idx, size_t alloc_idx)
+{
+    ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    ds_alloc_idx_t next = DS_ALLOC_IDX_NONE;
+
+    if (DS_ALLOC_IDX_NONE != prev_idx) {
+        next = p_records->next_phys[prev_idx];
+        p_records->next_phys[prev_idx] = (ds_alloc_idx_t)alloc_idx;
+    } else {
+        DS_ASSERT(DS_ALLOC_IDX_NONE == p_ds_buffer->tail_record);
+    }
+
+    p_records->prev_phys[alloc_idx] = (ds_alloc_idx_t)prev_idx;
+    p_records->next_phys[alloc_idx] = next;
+
+    if (DS_ALLOC_IDX_NONE != next) {
+        p_records->prev_phys[next] = (ds_alloc_idx_t)alloc_idx;
+    } else {
+        p_ds_buffer->tail_record = (ds_alloc_idx_t)alloc_idx;
+    }
+}
+
+static void ds_phys_unlink(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx)
+{
+    ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    const ds_alloc_idx_t prev = p_records->prev_phys[alloc_idx];
+    const ds_alloc_idx_t next = p_records->next_phys[alloc_idx];
+
+    if (DS_ALLOC_IDX_NONE != prev) {
+        p_records->next_phys[prev] = next;
+    }
+
+    if (DS_ALLOC_IDX_NONE != next) {
+        p_records->prev_phys[next] = prev;
+    } else {
+        p_ds_buffer->tail_record = prev;
+    }
+}
+
+static void ds_split_block(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t aligned_size)
+{
+    ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    const size_t capacity = p_records->size[alloc_idx];
+
+    DS_ASSERT(aligned_size <= capacity);
+
+    if ((aligned_size == capacity)
+        || ((p_ds_buffer->used_allocators + p_ds_buffer->parked_allocators) == p_ds_buffer->record_count)) {
+        return; /* nothing to split off, or no record to describe the remainder */
+    }
+
+    const size_t rest_idx = ds_spare_record(p_ds_buffer);
+
+    ds_set_capacity(p_ds_buffer, alloc_idx, aligned_size);
+    p_records->head[rest_idx] = (ds_offset_t)(p_records->head[alloc_idx] + aligned_size);
+    p_records->size[rest_idx] = (ds_offset_t)(capacity - aligned_size);
+    ds_set_status(p_ds_buffer, rest_idx, DS_FREE);
+    ds_phys_insert_after(p_ds_buffer, alloc_idx, rest_idx);
+    ds_free_list_push(p_ds_buffer, rest_idx);
+    p_ds_buffer->parked_allocators++;
+}
+
+static void ds_merge_into_prev(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx)
+{
+    ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    const size_t prev_idx = p_records->prev_phys[alloc_idx];
+
+    DS_ASSERT(DS_FREE == p_records->allocation_status[alloc_idx]);
+    DS_ASSERT((DS_ALLOC_IDX_NONE != prev_idx) && (DS_FREE == p_records->allocation_status[prev_idx]));
+
+    ds_free_list_unlink(p_ds_buffer, alloc_idx);
+    ds_free_list_unlink(p_ds_buffer, prev_idx);
+    p_records->size[prev_idx] = (ds_offset_t)(p_records->size[prev_idx] + p_records->size[alloc_idx]);
+    ds_free_list_push(p_ds_buffer, prev_idx);
+
+    ds_phys_unlink(p_ds_buffer, alloc_idx);
+    ds_set_status(p_ds_buffer, alloc_idx, DS_NOT_USED);
+    p_records->head[alloc_idx] = 0u;
+    p_records->size[alloc_idx] = 0u;
+    p_ds_buffer->parked_allocators--;
+}
+#endif
+
+#if (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
+static void ds_shrink_block(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t aligned_size)
+{
+    ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    const size_t head = p_records->head[alloc_idx];
+    const size_t capacity = p_records->size[alloc_idx];
+    const size_t next_idx = p_records->next_phys[alloc_idx];
+
+    DS_ASSERT(aligned_size < capacity);
+
+#if DS_ZERO_ON_FREE == 1u
+    ds_zero(&p_ds_buffer->memory[head + aligned_size], p_ds_buffer->memory_size - (head + aligned_size), capacity - aligned_size);
+#endif
+
+    if (DS_ALLOC_IDX_NONE == next_idx) {
+        ds_set_capacity(p_ds_buffer, alloc_idx, aligned_size);
+        p_ds_buffer->data_head = head + aligned_size;
+    } else if (DS_FREE == p_records->allocation_status[next_idx]) {
+        ds_free_list_unlink(p_ds_buffer, next_idx);
+        p_records->head[next_idx] = (ds_offset_t)(head + aligned_size);
+        p_records->size[next_idx] = (ds_offset_t)(p_records->size[next_idx] + (capacity - aligned_size));
+        ds_free_list_push(p_ds_buffer, next_idx);
+        ds_set_capacity(p_ds_buffer, alloc_idx, aligned_size);
+    } else {
+        ds_split_block(p_ds_buffer, alloc_idx, aligned_size);
+    }
+}
+
+static bool ds_grow_into_next(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t aligned_size)
+{
+    ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    const size_t capacity = p_records->size[alloc_idx];
+    size_t available = capacity;
+
+    for (size_t iter = p_records->next_phys[alloc_idx];
+         (available < aligned_size) && (DS_ALLOC_IDX_NONE != iter) && (DS_FREE == p_records->allocation_status[iter]);
+         iter = p_records->next_phys[iter]) {
+        available += p_records->size[iter];
+    }
+
+    if (available < aligned_size) {
+        return false;
+    }
+
+    size_t missing = aligned_size - capacity;
+
+    while (0u != missing) {
+        const size_t next_idx = p_records->next_phys[alloc_idx];
+        const size_t next_size = p_records->size[next_idx];
+
+        ds_free_list_unlink(p_ds_buffer, next_idx);
+        if (next_size <= missing) {
+            ds_phys_unlink(p_ds_buffer, next_idx);
+            ds_set_status(p_ds_buffer, next_idx, DS_NOT_USED);
+            p_records->head[next_idx] = 0u;
+            p_records->size[next_idx] = 0u;
+            p_ds_buffer->parked_allocators--;
+            missing -= next_size;
+        } else {
+            p_records->head[next_idx] = (ds_offset_t)(p_records->head[next_idx] + missing);
+            p_records->size[next_idx] = (ds_offset_t)(next_size - missing);
+            ds_free_list_push(p_ds_buffer, next_idx);
+            missing = 0u;
+        }
+    }
+
+    ds_set_capacity(p_ds_buffer, alloc_idx, aligned_size);
+#if DS_OWNER_MAP == 1u
+    ds_owner_map_assign(p_ds_buffer, p_records->head[alloc_idx] + capacity, p_records->head[alloc_idx] + aligned_size, alloc_idx);
+#endif
+    return true;
+}
+#endif
+
+#if (DS_COALESCE_ON_FREE == 1u) && (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
+static void ds_coalesce_block(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx)
+{
+    const ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    const size_t next_idx = p_records->next_phys[alloc_idx];
+    const size_t prev_idx = p_records->prev_phys[alloc_idx];
+
+    if ((DS_ALLOC_IDX_NONE != next_idx) && (DS_FREE == p_records->allocation_status[next_idx])) {
+        ds_merge_into_prev(p_ds_buffer, next_idx);
+    }
+
+    if ((DS_ALLOC_IDX_NONE != prev_idx) && (DS_FREE == p_records->allocation_status[prev_idx])) {
+        ds_merge_into_prev(p_ds_buffer, alloc_idx);
+    }
+}
+#endif
+
+#if DS_OWNER_MAP == 1u
+static void ds_owner_map_assign(dynostatic_buffer_t *p_ds_buffer, size_t first_offset, size_t end_offset, size_t alloc_idx)
+{
+    DS_ASSERT((end_offset >> p_ds_buffer->granule_shift) <= p_ds_buffer->granule_count);
+
+    for (size_t granule = first_offset >> p_ds_buffer->granule_shift; granule < (end_offset >> p_ds_buffer->granule_shift); granule++) {
+        p_ds_buffer->owner_map[granule] = (ds_alloc_idx_t)alloc_idx;
+    }
+}
+#endif
+
+#if DS_ENGINE == DS_ENGINE_BUDDY
+static inline size_t ds_buddy_block_size(const dynostatic_buffer_t *p_ds_buffer, size_t aligned_size)
+{
+    const uint32_t granules = (uint32_t)(aligned_size >> p_ds_buffer->granule_shift);
+    uint32_t order = ds_highest_bit(granules);
+
+    if (granules != ((uint32_t)1u << order)) {
+        order++;
+    }
+    return (size_t)1u << (p_ds_buffer->granule_shift + order);
+}
+
+static size_t ds_buddy_frontier_chunk(const dynostatic_buffer_t *p_ds_buffer)
+{
+    const size_t remaining = p_ds_buffer->memory_size - p_ds_buffer->data_head;
+    size_t chunk = p_ds_buffer->buddy_chunk_size;
+
+    while (chunk > remaining) {
+        if (((size_t)1u << p_ds_buffer->granule_shift) == chunk) {
+            return 0u; /* only an unaligned buffer tail is left */
+        }
+        chunk /= 2u;
+    }
+
+    DS_ASSERT((p_ds_buffer->data_head % chunk) == 0u);
+    return chunk;
+}
+
+static void ds_buddy_split(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t aligned_size)
+{
+    while (((p_ds_buffer->allocators.size[alloc_idx] / 2u) >= aligned_size)
+           && ((p_ds_buffer->used_allocators + p_ds_buffer->parked_allocators) < p_ds_buffer->record_count)) {
+        ds_split_block(p_ds_buffer, alloc_idx, p_ds_buffer->allocators.size[alloc_idx] / 2u);
+    }
+}
+
+static bool ds_buddy_find(const dynostatic_buffer_t *p_ds_buffer, size_t head, size_t size, size_t *p_buddy_idx)
+{
+    const ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    const size_t buddy_head = head ^ size;
+
+    if (buddy_head >= p_ds_buffer->data_head) {
+        return false; /* untouched space: the block is a whole chunk */
+    }
+
+    const size_t buddy_idx = p_ds_buffer->owner_map[buddy_head >> p_ds_buffer->granule_shift];
+
+    if ((DS_FREE != p_records->allocation_status[buddy_idx]) || (buddy_head != p_records->head[buddy_idx])
+        || (size != p_records->size[buddy_idx])) {
+        return false; /* live, split, or a stale entry */
+    }
+
+    *p_buddy_idx = buddy_idx;
+    return true;
+}
+
+static void ds_buddy_release(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx)
+{
+    ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    size_t iter = alloc_idx;
+    size_t buddy_idx;
+
+    ds_set_status(p_ds_buffer, alloc_idx, DS_FREE);
+    ds_free_list_push(p_ds_buffer, alloc_idx);
+    p_ds_buffer->parked_allocators++;
+
+    while ((p_records->size[iter] < p_ds_buffer->buddy_chunk_size)
+           && ds_buddy_find(p_ds_buffer, p_records->head[iter], p_records->size[iter], &buddy_idx)) {
+        if (p_records->head[buddy_idx] < p_records->head[iter]) {
+            ds_merge_into_prev(p_ds_buffer, iter); /* the lower buddy survives */
+            iter = buddy_idx;
+        } else {
+            ds_merge_into_prev(p_ds_buffer, buddy_idx);
+        }
+    }
+
+    iter = p_ds_buffer->tail_record;
+    while ((DS_ALLOC_IDX_NONE != iter) && (DS_FREE == p_records->allocation_status[iter])
+           && ((p_ds_buffer->buddy_chunk_size == p_records->size[iter]) || ((p_records->head[iter] & p_records->size[iter]) == 0u))) {
+        ds_free_list_unlink(p_ds_buffer, iter);
+        p_ds_buffer->parked_allocators--;
+        p_ds_buffer->data_head = p_records->head[iter];
+        ds_phys_unlink(p_ds_buffer, iter);
+        ds_set_status(p_ds_buffer, iter, DS_NOT_USED);
+        p_records->head[iter] = 0u;
+        p_records->size[iter] = 0u;
+        iter = p_ds_buffer->tail_record;
+    }
+}
+
+static bool ds_buddy_grow(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t aligned_size)
+{
+    ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    const size_t head = p_records->head[alloc_idx];
+    const size_t capacity = p_records->size[alloc_idx];
+    size_t buddy_idx;
+
+    for (size_t size = capacity; size < aligned_size; size *= 2u) {
+        if (((head & size) != 0u) || !ds_buddy_find(p_ds_buffer, head, size, &buddy_idx)) {
+            return false;
+        }
+    }
+
+    for (size_t size = capacity; size < aligned_size; size *= 2u) {
+        buddy_idx = p_ds_buffer->owner_map[(head + size) >> p_ds_buffer->granule_shift];
+        ds_free_list_unlink(p_ds_buffer, buddy_idx);
+        ds_phys_unlink(p_ds_buffer, buddy_idx);
+        ds_set_status(p_ds_buffer, buddy_idx, DS_NOT_USED);
+        p_records->head[buddy_idx] = 0u;
+        p_records->size[buddy_idx] = 0u;
+        p_ds_buffer->parked_allocators--;
+    }
+
+    ds_set_capacity(p_ds_buffer, alloc_idx, aligned_size);
+    ds_owner_map_assign(p_ds_buffer, head + capacity, head + aligned_size, alloc_idx);
+    return true;
+}
+#endif
+
+#if DS_ENGINE == DS_ENGINE_BITMAP
+static inline uint32_t ds_bitmap_word(const dynostatic_buffer_t *p_ds_buffer, size_t word)
+{
+    uint32_t used = p_ds_buffer->granule_map[word];
+    const size_t tail = p_ds_buffer->granule_count % 32u;
+
+    if ((0u != tail) && ((p_ds_buffer->granule_count / 32u) == word)) {
+        used |= ~(((uint32_t)1u << tail) - 1u); /* granules past the arena read as used */
+    }
+    return used;
+}
+
+static size_t ds_bitmap_skip_full(const dynostatic_buffer_t *p_ds_buffer, size_t word)
+{
+    const size_t words = DS_BIT_WORDS(p_ds_buffer->granule_count);
+    size_t iter = word;
+
+    /* Unaligned loads: record storage is only DS_RECORD_STORAGE_ALIGN-aligned. */
+#if defined(__AVX2__)
+    const __m256i full8 = _mm256_set1_epi32(-1);
+
+    while (((iter + 8u) <= words)
+           && (0 != _mm256_testc_si256(_mm256_loadu_si256((const __m256i *)&p_ds_buffer->granule_map[iter]), full8))) {
+        iter += 8u;
+    }
+#endif
+#if defined(__AVX2__) || defined(__SSE4_1__)
+    const __m128i full4 = _mm_set1_epi32(-1);
+
+    while (((iter + 4u) <= words)
+           && (0 != _mm_testc_si128(_mm_loadu_si128((const __m128i *)&p_ds_buffer->granule_map[iter]), full4))) {
+        iter += 4u;
+    }
+#endif
+    while ((iter < words) && (UINT32_MAX == ds_bitmap_word(p_ds_buffer, iter))) {
+        iter++;
+    }
+    return iter;
+}
+
+static inline uint32_t ds_bitmap_runs_in_word(uint32_t free_bits, size_t granules)
+{
+    uint32_t starts = free_bits;
+    size_t length = 1u;
+
+    DS_ASSERT((granules >= 1u) && (granules < 32u));
+
+    while ((length < granules) && (0u != starts)) {
+        const size_t shift = ((granules - length) < length) ? (granules - length) : length;
+        starts &= starts >> shift;
+        length += shift;
+    }
+    return starts;
+}
+
+static inline uint32_t ds_bitmap_mask(size_t bit, size_t span)
+{
+    DS_ASSERT((span >= 1u) && ((bit + span) <= 32u));
+    return (UINT32_MAX >> (32u - span)) << bit;
+}
+
+static bool ds_bitmap_find_run(const dynostatic_buffer_t *p_ds_buffer, size_t granules, size_t *p_first)
+{
+    const size_t words = DS_BIT_WORDS(p_ds_buffer->granule_count);
+    size_t run = 0u; /* free granules ending where the current word starts */
+    size_t word = 0u;
+
+    while (word < words) {
+        if (0u == run) {
+            word = ds_bitmap_skip_full(p_ds_buffer, word);
+            if (words == word) {
+                break;
+            }
+        }
+
+        const uint32_t used = ds_bitmap_word(p_ds_buffer, word);
+        const size_t base = word * 32u;
+
+        if (0u == used) {
+            run += 32u;
+            if (run >= granules) {
+                *p_first = (base + 32u) - run;
+                return true;
+            }
+        } else {
+            if ((run + ds_lowest_bit(used)) >= granules) {
+                *p_first = base - run;
+                return true;
+            }
+            if (granules < 32u) {
+                const uint32_t starts = ds_bitmap_runs_in_word(~used, granules);
+                if (0u != starts) {
+                    *p_first = base + ds_lowest_bit(starts);
+                    return true;
+                }
+            }
+            run = 31u - ds_highest_bit(used);
+        }
+        word++;
+    }
+
+    return false;
+}
+
+static size_t ds_bitmap_largest_run(const dynostatic_buffer_t *p_ds_buffer)
+{
+    const size_t words = DS_BIT_WORDS(p_ds_buffer->granule_count);
+    size_t largest = 0u;
+    size_t run = 0u;
+    size_t word = 0u;
+
+    while (word < words) {
+        if (0u == run) {
+            word = ds_bitmap_skip_full(p_ds_buffer, word);
+            if (words == word) {
+                break;
+            }
+        }
+
+        const uint32_t used = ds_bitmap_word(p_ds_buffer, word);
+
+        if (0u == used) {
+            run += 32u;
+        } else {
+            run += ds_lowest_bit(used);
+            if (run > largest) {
+                largest = run;
+            }
+
+            /* A run inside the word is shorter than 31 granules, so it only
+             * matters while nothing that long was found. Every AND shortens
+             * each run by one: the number of rounds is the longest. */
+            if (largest < 31u) {
+                uint32_t starts = ~used;
+                size_t inner = 0u;
+
+                while (0u != starts) {
+                    starts &= starts >> 1u;
+                    inner++;
+                }
+                if (inner > largest) {
+                    largest = inner;
+                }
+            }
+            run = 31u - ds_highest_bit(used);
+        }
+        word++;
+    }
+
+    return (run > largest) ? run : largest;
+}
+
+static void ds_bitmap_mark(dynostatic_buffer_t *p_ds_buffer, size_t first, size_t count, bool used)
+{
+    size_t granule = first;
+    size_t left = count;
+
+    DS_ASSERT((first + count) <= p_ds_buffer->granule_count);
+
+    while (0u != left) {
+        const size_t bit = granule % 32u;
+        const size_t span = ((32u - bit) < left) ? (32u - bit) : left;
+        const uint32_t mask = ds_bitmap_mask(bit, span);
+
+        if (used) {
+            p_ds_buffer->granule_map[granule / 32u] |= mask;
+        } else {
+            p_ds_buffer->granule_map[granule / 32u] &= ~mask;
+        }
+        granule += span;
+        left -= span;
+    }
+}
+
+static bool ds_bitmap_range_free(const dynostatic_buffer_t *p_ds_buffer, size_t first, size_t count)
+{
+    size_t granule = first;
+    size_t left = count;
+
+    DS_ASSERT((first + count) <= p_ds_buffer->granule_count);
+
+    while (0u != left) {
+        const size_t bit = granule % 32u;
+        const size_t span = ((32u - bit) < left) ? (32u - bit) : left;
+
+        if (0u != (p_ds_buffer->granule_map[granule / 32u] & ds_bitmap_mask(bit, span))) {
+            return false;
+        }
+        granule += span;
+        left -= span;
+    }
+    return true;
+}
+
+static void ds_bitmap_lower_head(dynostatic_buffer_t *p_ds_buffer)
+{
+    /* Bits at and above data_head are clear, so whole words can be tested. */
+    size_t words = DS_BIT_WORDS(p_ds_buffer->data_head >> p_ds_buffer->granule_shift);
+
+    while ((0u != words) && (0u == p_ds_buffer->granule_map[words - 1u])) {
+        words--;
+    }
+
+    if (0u == words) {
+        p_ds_buffer->data_head = 0u;
+    } else {
+        const size_t top = ((words - 1u) * 32u) + ds_highest_bit(p_ds_buffer->granule_map[words - 1u]);
+        p_ds_buffer->data_head = (top + 1u) << p_ds_buffer->granule_shift;
+    }
+}
+
+static bool ds_bitmap_resize(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx, size_t aligned_size)
+{
+    const size_t head = p_ds_buffer->allocators.head[alloc_idx];
+    const size_t capacity = p_ds_buffer->allocators.size[alloc_idx];
+
+    DS_ASSERT(aligned_size != capacity);
+
+    if (aligned_size < capacity) {
+#if DS_ZERO_ON_FREE == 1u
+        ds_zero(&p_ds_buffer->memory[head + aligned_size], p_ds_buffer->memory_size - (head + aligned_size), capacity - aligned_size);
+#endif
+        ds_bitmap_mark(p_ds_buffer, (head + aligned_size) >> p_ds_buffer->granule_shift, (capacity - aligned_size) >> p_ds_buffer->granule_shift, false);
+        ds_set_capacity(p_ds_buffer, alloc_idx, aligned_size);
+        if ((head + capacity) == p_ds_buffer->data_head) {
+            p_ds_buffer->data_head = head + aligned_size;
+        }
+        return true;
+    }
+
+    if (((head + aligned_size) > (p_ds_buffer->granule_count << p_ds_buffer->granule_shift))
+        || !ds_bitmap_range_free(p_ds_buffer, (head + capacity) >> p_ds_buffer->granule_shift, (aligned_size - capacity) >> p_ds_buffer->granule_shift)) {
+        return false;
+    }
+
+    ds_bitmap_mark(p_ds_buffer, (head + capacity) >> p_ds_buffer->granule_shift, (aligned_size - capacity) >> p_ds_buffer->granule_shift, true);
+    ds_set_capacity(p_ds_buffer, alloc_idx, aligned_size);
+    ds_owner_map_assign(p_ds_buffer, head + capacity, head + aligned_size, alloc_idx);
+    if ((head + aligned_size) > p_ds_buffer->data_head) {
+        p_ds_buffer->data_head = head + aligned_size;
+    }
+    return true;
+}
+#endif
+
+#if DS_HANDLES == 1u
+static bool ds_handle_record(const dynostatic_buffer_t *p_ds_buffer, ds_handle_t handle, size_t *p_alloc_idx)
+{
+    const size_t alloc_idx = handle & 0xFFFFu;
+
+    if ((alloc_idx >= p_ds_buffer->record_count)
+        || (0u == (p_ds_buffer->handle_map[alloc_idx / 32u] & ((uint32_t)1u << (alloc_idx % 32u))))
+        || ((handle >> 16u) != p_ds_buffer->allocators.generation[alloc_idx])) {
+        return false;
+    }
+
+    *p_alloc_idx = alloc_idx;
+    return true;
+}
+
+#if DS_ENGINE != DS_ENGINE_BITMAP
+static void ds_phys_swap(dynostatic_buffer_t *p_ds_buffer, size_t first_idx, size_t second_idx)
+{
+    ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+
+    if (p_records->next_phys[first_idx] == second_idx) {
+        ds_phys_unlink(p_ds_buffer, first_idx);
+        ds_phys_insert_after(p_ds_buffer, second_idx, first_idx);
+        return;
+    }
+    if (p_records->next_phys[second_idx] == first_idx) {
+        ds_phys_unlink(p_ds_buffer, second_idx);
+        ds_phys_insert_after(p_ds_buffer, first_idx, second_idx);
+        return;
+    }
+
+    /* Apart: re-point the four neighbours, then trade the links. */
+    const ds_alloc_idx_t first_prev = p_records->prev_phys[first_idx];
+    const ds_alloc_idx_t first_next = p_records->next_phys[first_idx];
+    const ds_alloc_idx_t second_prev = p_records->prev_phys[second_idx];
+    const ds_alloc_idx_t second_next = p_records->next_phys[second_idx];
+
+    if (DS_ALLOC_IDX_NONE != first_prev) {
+        p_records->next_phys[first_prev] = (ds_alloc_idx_t)second_idx;
+    }
+    if (DS_ALLOC_IDX_NONE != first_next) {
+        p_records->prev_phys[first_next] = (ds_alloc_idx_t)second_idx;
+    }
+    if (DS_ALLOC_IDX_NONE != second_prev) {
+        p_records->next_phys[second_prev] = (ds_alloc_idx_t)first_idx;
+    }
+    if (DS_ALLOC_IDX_NONE != second_next) {
+        p_records->prev_phys[second_next] = (ds_alloc_idx_t)first_idx;
+    }
+
+    p_records->prev_phys[first_idx] = second_prev;
+    p_records->next_phys[first_idx] = second_next;
+    p_records->prev_phys[second_idx] = first_prev;
+    p_records->next_phys[second_idx] = first_next;
+
+    if (first_idx == p_ds_buffer->tail_record) {
+        p_ds_buffer->tail_record = (ds_alloc_idx_t)second_idx;
+    } else if (second_idx == p_ds_buffer->tail_record) {
+        p_ds_buffer->tail_record = (ds_alloc_idx_t)first_idx;
+    } else {
+        /* neither is the tail */
+    }
+}
+#endif
+
+#if DS_ENGINE == DS_ENGINE_BUDDY
+static bool ds_compact_block(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx)
+{
+    ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    const size_t head = p_records->head[alloc_idx];
+    const size_t size = p_records->size[alloc_idx];
+    const uint32_t list = ds_free_list_of(p_ds_buffer, size);
+    size_t free_idx = DS_ALLOC_IDX_NONE;
+
+    /* Every block of the order's list has this size, so any lower one fits. */
+    if (ds_free_list_occupied(p_ds_buffer, list)) {
+        for (size_t iter = p_ds_buffer->free_classes[list]; DS_ALLOC_IDX_NONE != iter; iter = p_records->next_free[iter]) {
+            if ((p_records->head[iter] < head)
+                && ((DS_ALLOC_IDX_NONE == free_idx) || (p_records->head[iter] < p_records->head[free_idx]))) {
+                free_idx = iter;
+            }
+        }
+    }
+
+    if (DS_ALLOC_IDX_NONE == free_idx) {
+        return false;
+    }
+
+    const size_t free_head = p_records->head[free_idx];
+
+    ds_memcpy(&p_ds_buffer->memory[free_head], size, &p_ds_buffer->memory[head], size);
+#if DS_ZERO_ON_FREE == 1u
+    ds_zero(&p_ds_buffer->memory[head], p_ds_buffer->memory_size - head, size);
+#endif
+
+    /* The vacated block is released like a freed one, so it merges with its
+     * buddy and a whole free chunk at the tail is reclaimed. */
+    ds_free_list_unlink(p_ds_buffer, free_idx);
+    p_ds_buffer->parked_allocators--;
+    ds_phys_swap(p_ds_buffer, alloc_idx, free_idx);
+    p_records->head[alloc_idx] = (ds_offset_t)free_head;
+    p_records->head[free_idx] = (ds_offset_t)head;
+    ds_owner_map_assign(p_ds_buffer, free_head, free_head + size, alloc_idx);
+    ds_buddy_release(p_ds_buffer, free_idx);
+    return true;
+}
+#elif DS_ENGINE == DS_ENGINE_BITMAP
+static bool ds_compact_block(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx)
+{
+    const size_t head = p_ds_buffer->allocators.head[alloc_idx];
+    const size_t size = p_ds_buffer->allocators.size[alloc_idx];
+    const size_t granules = size >> p_ds_buffer->granule_shift;
+    size_t first_granule;
+
+    /* With its own granules cleared the block always finds a run, at worst
+     * where it already is. */
+    ds_bitmap_mark(p_ds_buffer, head >> p_ds_buffer->granule_shift, granules, false);
+    if (!ds_bitmap_find_run(p_ds_buffer, granules, &first_granule) || ((first_granule << p_ds_buffer->granule_shift) >= head)) {
+        ds_bitmap_mark(p_ds_buffer, head >> p_ds_buffer->granule_shift, granules, true);
+        return false;
+    }
+
+    const size_t new_head = first_granule << p_ds_buffer->granule_shift;
+
+    ds_memmove(&p_ds_buffer->memory[new_head], p_ds_buffer->memory_size - new_head, &p_ds_buffer->memory[head], size);
+#if DS_ZERO_ON_FREE == 1u
+    const size_t vacated = ((new_head + size) > head) ? (new_head + size) : head;
+    ds_zero(&p_ds_buffer->memory[vacated], p_ds_buffer->memory_size - vacated, (head + size) - vacated);
+#endif
+
+    ds_bitmap_mark(p_ds_buffer, first_granule, granules, true);
+    p_ds_buffer->allocators.head[alloc_idx] = (ds_offset_t)new_head;
+    ds_owner_map_assign(p_ds_buffer, new_head, new_head + size, alloc_idx);
+    if ((head + size) == p_ds_buffer->data_head) {
+        ds_bitmap_lower_head(p_ds_buffer);
+    }
+    return true;
+}
+#else
+static bool ds_compact_block(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx)
+{
+    ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    const size_t free_idx = p_records->prev_phys[alloc_idx];
+
+    if ((DS_ALLOC_IDX_NONE == free_idx) || (DS_FREE != p_records->allocation_status[free_idx])) {
+        return false;
+    }
+
+    const size_t head = p_records->head[free_idx];
+    const size_t gap = p_records->size[free_idx];
+    const size_t size = p_records->size[alloc_idx];
+
+    /* Slide the block down over its parked predecessor, which keeps its size
+     * (and so its free list) and moves up behind the block. */
+    ds_memmove(&p_ds_buffer->memory[head], p_ds_buffer->memory_size - head, &p_ds_buffer->memory[head + gap], size);
+#if DS_ZERO_ON_FREE == 1u
+    ds_zero(&p_ds_buffer->memory[head + size], p_ds_buffer->memory_size - (head + size), gap);
+#endif
+    ds_phys_swap(p_ds_buffer, free_idx, alloc_idx);
+    p_records->head[alloc_idx] = (ds_offset_t)head;
+    p_records->head[free_idx] = (ds_offset_t)(head + size);
+#if DS_OWNER_MAP == 1u
+    ds_owner_map_assign(p_ds_buffer, head, head + size, alloc_idx);
+#endif
+
+    const size_t next_idx = p_records->next_phys[free_idx];
+
+    if (DS_ALLOC_IDX_NONE == next_idx) {
+        ds_free_list_unlink(p_ds_buffer, free_idx);
+        p_ds_buffer->parked_allocators--;
+        ds_reclaim_trailing(p_ds_buffer, free_idx);
+    } else if (DS_FREE == p_records->allocation_status[next_idx]) {
+        ds_merge_into_prev(p_ds_buffer, next_idx); /* even without DS_COALESCE_ON_FREE: compaction is the deferred work */
+    } else {
+        /* a live block follows: the next move slides it down */
+    }
+    return true;
+}
+#endif
+#endif
+
+/*---Public-Function-Implementation---*/
+
+#if DS_EMBEDDED_STORAGE == 1u
+ds_err_code_t ds_initialize_allocation(dynostatic_buffer_t *p_ds_buffer)
+{
+    if (NULL == p_ds_buffer) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (p_ds_buffer->init_magic == DS_MAGIC_NUMBER) {
+        return ERROR_DS_ALREADY_INIT;
+    }
+
+    ds_config_t config;
+
+    config.p_memory = p_ds_buffer->arena;
+    config.memory_size = sizeof(p_ds_buffer->arena);
+    config.p_records = p_ds_buffer->record_storage;
+    config.records_size = sizeof(p_ds_buffer->record_storage);
+    config.record_count = DS_MAX_ALLOCATION_COUNT;
+    config.alignment = DS_ALIGNMENT;
+    config.max_allocation_size = DS_MAX_ALLOCATION_SIZE;
+    DS_ASSERT(ds_config_valid(&config)); /* the header's static asserts hold the same rules */
+
+    ds_attach_storage(p_ds_buffer, &config);
+#if DS_ENGINE == DS_ENGINE_BUDDY
+    p_ds_buffer->buddy_chunk_size = DS_BUDDY_CHUNK_SIZE; /* may exceed the cap, unlike the derived one */
+#endif
+    p_ds_buffer->init_magic = DS_MAGIC_NUMBER;
+    return ERROR_DS_OK;
+}
+#endif
+
+ds_err_code_t ds_initialize_allocation_ex(dynostatic_buffer_t *p_ds_buffer, const ds_config_t *p_config)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_config)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (p_ds_buffer->init_magic == DS_MAGIC_NUMBER) {
+        return ERROR_DS_ALREADY_INIT;
+    }
+
+    if (!ds_config_valid(p_config)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    ds_attach_storage(p_ds_buffer, p_config);
+    p_ds_buffer->init_magic = DS_MAGIC_NUMBER;
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_malloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t size)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_memory) || (size == 0u)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    if (size > p_ds_buffer->max_allocation_size) {
+        return ERROR_DS_TOO_BIG_CHUNK;
+    }
+
+    size_t alloc_idx;
+    ds_err_code_t ret = ds_find_allocator_for_memory(p_ds_buffer, *p_memory, &alloc_idx);
+    if (ret == ERROR_DS_OK) {
+        return ERROR_DS_PTR_ALLOC_YET;
+    }
+
+    ret = ds_get_new_allocator(p_ds_buffer, size, &alloc_idx);
+    if (ret != ERROR_DS_OK) {
+        return ret;
+    }
+
+    *p_memory = &p_ds_buffer->memory[p_ds_buffer->allocators.head[alloc_idx]];
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_free(dynostatic_buffer_t *p_ds_buffer, void **p_memory)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_memory) || (NULL == *p_memory)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    size_t alloc_idx;
+    ds_err_code_t ret = ds_find_allocator_for_memory(p_ds_buffer, *p_memory, &alloc_idx);
+    if (ret != ERROR_DS_OK) {
+        return ret;
+    }
+
+#if DS_HANDLES == 1u
+    if (0u != (p_ds_buffer->handle_map[alloc_idx / 32u] & ((uint32_t)1u << (alloc_idx % 32u)))) {
+        return ERROR_DS_INVALID_ARG; /* released by ds_hfree() only, so its handle goes stale */
+    }
+#endif
+
+    ds_release_block(p_ds_buffer, alloc_idx);
+    *p_memory = NULL;
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_calloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t len, size_t size_of_elem)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_memory) || (len == 0u) || (size_of_elem == 0u)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    size_t total_size = len * size_of_elem;
+    if ((total_size / len) != size_of_elem) { /* Check for overflow */
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    ds_err_code_t ret = ds_malloc(p_ds_buffer, p_memory, total_size);
+    if (ret != ERROR_DS_OK) {
+        return ret;
+    }
+
+    ds_zero(*p_memory, ds_align_up(p_ds_buffer, total_size), total_size);
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_aligned_malloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t alignment, size_t size)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_memory) || (size == 0u) || (alignment == 0u)
+        || (0u != (alignment & (alignment - 1u)))) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    const size_t granule = (size_t)1u << p_ds_buffer->granule_shift;
+
+    if (alignment <= granule) {
+        return ds_malloc(p_ds_buffer, p_memory, size); /* every block is aligned that far */
+    }
+
+    /* The padding must fit too, so the block can be placed before its
+     * address is known. */
+#if DS_ENGINE == DS_ENGINE_BUDDY
+    if ((size > p_ds_buffer->max_allocation_size) || (alignment > p_ds_buffer->max_allocation_size)) {
+        return ERROR_DS_TOO_BIG_CHUNK;
+    }
+#else
+    if ((size > p_ds_buffer->max_allocation_size) || ((alignment - granule) > (p_ds_buffer->max_allocation_size - size))) {
+        return ERROR_DS_TOO_BIG_CHUNK;
+    }
+#endif
+
+    size_t alloc_idx;
+    ds_err_code_t ret = ds_find_allocator_for_memory(p_ds_buffer, *p_memory, &alloc_idx);
+    if (ret == ERROR_DS_OK) {
+        return ERROR_DS_PTR_ALLOC_YET;
+    }
+
+    ret = ds_get_aligned_allocator(p_ds_buffer, size, alignment, &alloc_idx);
+    if (ret != ERROR_DS_OK) {
+        return ret;
+    }
+
+    *p_memory = &p_ds_buffer->memory[p_ds_buffer->allocators.head[alloc_idx]];
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_aligned_calloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t alignment, size_t len, size_t size_of_elem)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_memory) || (len == 0u) || (size_of_elem == 0u)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    size_t total_size = len * size_of_elem;
+    if ((total_size / len) != size_of_elem) { /* Check for overflow */
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    ds_err_code_t ret = ds_aligned_malloc(p_ds_buffer, p_memory, alignment, total_size);
+    if (ret != ERROR_DS_OK) {
+        return ret;
+    }
+
+    ds_zero(*p_memory, ds_align_up(p_ds_buffer, total_size), total_size);
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_realloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t size)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_memory)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    if (size == 0u) {
+        return ds_free(p_ds_buffer, p_memory);
+    }
+
+    if (*p_memory == NULL) {
+        return ds_malloc(p_ds_buffer, p_memory, size);
+    }
+
+    if (size > p_ds_buffer->max_allocation_size) {
+        return ERROR_DS_TOO_BIG_CHUNK;
+    }
+
+    size_t alloc_idx;
+    ds_err_code_t ret = ds_find_allocator_for_memory(p_ds_buffer, *p_memory, &alloc_idx);
+    if (ret != ERROR_DS_OK) {
+        return ret; /* OUT_OF_DS / ALLOCATOR_NOT_FOUND — original contract bug fixed */
+    }
+
+#if DS_HANDLES == 1u
+    if (0u != (p_ds_buffer->handle_map[alloc_idx / 32u] & ((uint32_t)1u << (alloc_idx % 32u)))) {
+        return ERROR_DS_INVALID_ARG; /* a move would change the record its handle names */
+    }
+#endif
+
+    const size_t capacity = p_ds_buffer->allocators.size[alloc_idx];
+    const size_t aligned_size = ds_fit_size(p_ds_buffer, size);
+
+    if (ds_align_up(p_ds_buffer, size) <= capacity) {
+        /* Fits already; never grow just to honour DS_FIT_ROUNDED's grid. */
+        if (aligned_size < capacity) {
+            ds_shrink_in_place(p_ds_buffer, alloc_idx, aligned_size);
+        }
+#if DS_TRACK_REQUESTED == 1u
+        ds_set_requested(p_ds_buffer, alloc_idx, size);
+#endif
+        return ERROR_DS_OK;
+    }
+
+    if (ds_grow_in_place(p_ds_buffer, alloc_idx, aligned_size)) {
+#if DS_TRACK_REQUESTED == 1u
+        ds_set_requested(p_ds_buffer, alloc_idx, size);
+#endif
+        return ERROR_DS_OK;
+    }
+
+    /* Move path: allocate FIRST, so any failure leaves the original intact. */
+    size_t new_idx;
+    ret = ds_get_new_allocator(p_ds_buffer, size, &new_idx);
+    if (ret != ERROR_DS_OK) {
+        return ret;
+    }
+#if DS_GROUPS == 1u
+    p_ds_buffer->allocators.group[new_idx] = p_ds_buffer->allocators.group[alloc_idx]; /* still a member */
+#endif
+
+    void *const p_new = &p_ds_buffer->memory[p_ds_buffer->allocators.head[new_idx]];
+
+#if DS_TRACK_REQUESTED == 1u
+    ds_memcpy(p_new, aligned_size, *p_memory, p_ds_buffer->allocators.requested[alloc_idx]); /* live bytes only */
+#else
+    ds_memcpy(p_new, aligned_size, *p_memory, capacity);
+#endif
+
+    ret = ds_free(p_ds_buffer, p_memory); /* zeroes old block under DS_ZERO_ON_FREE; may cascade */
+    DS_ASSERT(ret == ERROR_DS_OK);
+    (void)ret;
+
+    *p_memory = p_new;
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_malloc_batch(dynostatic_buffer_t *p_ds_buffer, void **p_memories, const size_t *p_sizes, size_t count)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_memories) || (NULL == p_sizes) || (count == 0u)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    /* Validate every entry, and turn away a batch that cannot fit, before
+     * the instance is touched. Free bytes are an upper bound: the engines
+     * may still fail on fragmentation, which the rollback below covers. */
+    size_t free_bytes = p_ds_buffer->memory_size - p_ds_buffer->used_bytes;
+    bool fits = true;
+    size_t alloc_idx;
+
+    for (size_t i = 0u; i < count; i++) {
+        if (p_sizes[i] == 0u) {
+            return ERROR_DS_INVALID_ARG;
+        }
+        if (p_sizes[i] > p_ds_buffer->max_allocation_size) {
+            return ERROR_DS_TOO_BIG_CHUNK;
+        }
+        if (ERROR_DS_OK == ds_find_allocator_for_memory(p_ds_buffer, p_memories[i], &alloc_idx)) {
+            return ERROR_DS_PTR_ALLOC_YET;
+        }
+
+        const size_t fit_size = ds_fit_size(p_ds_buffer, p_sizes[i]);
+        if (fit_size > free_bytes) {
+            fits = false;
+        } else {
+            free_bytes -= fit_size;
+        }
+    }
+
+    if (count > (p_ds_buffer->record_count - p_ds_buffer->used_allocators)) {
+        return ERROR_DS_NO_ALLOCATORS;
+    }
+
+    if (!fits) {
+        return ERROR_DS_NO_MEMORY;
+    }
+
+    const size_t next_fit_offset = p_ds_buffer->next_fit_offset;
+    ds_err_code_t ret = ERROR_DS_OK;
+    size_t placed = 0u;
+
+    while ((placed < count) && (ERROR_DS_OK == ret)) {
+#if (DS_COALESCE_ON_FREE == 0u) && (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
+        const size_t parked = p_ds_buffer->parked_allocators;
+#endif
+        ret = ds_get_new_allocator(p_ds_buffer, p_sizes[placed], &alloc_idx);
+        if (ERROR_DS_OK == ret) {
+#if (DS_COALESCE_ON_FREE == 0u) && (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
+            /* A live record's free-list links are unused, so next_free keeps
+             * the remainder a reused parked block was split into, if any: a
+             * reuse without a split parks one record fewer, a bump placement
+             * is the tail. The rollback joins the two halves again. */
+            const size_t next_idx = p_ds_buffer->allocators.next_phys[alloc_idx];
+            p_ds_buffer->allocators.next_free[alloc_idx] = (parked == p_ds_buffer->parked_allocators)
+                                                               ? (ds_alloc_idx_t)next_idx
+                                                               : DS_ALLOC_IDX_NONE;
+#endif
+            p_memories[placed] = &p_ds_buffer->memory[p_ds_buffer->allocators.head[alloc_idx]];
+            placed++;
+        }
+    }
+
+    if (ERROR_DS_OK != ret) {
+        /* Last placed first, so each block is released into the state its
+         * placement left: a trailing block is reclaimed rather than parked,
+         * and a split-off remainder is still its physical successor. */
+        while (0u != placed) {
+            placed--;
+            const ds_err_code_t found = ds_find_allocator_for_memory(p_ds_buffer, p_memories[placed], &alloc_idx);
+            DS_ASSERT(found == ERROR_DS_OK);
+            (void)found;
+#if (DS_COALESCE_ON_FREE == 0u) && (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
+            const size_t rest_idx = p_ds_buffer->allocators.next_free[alloc_idx];
+#endif
+            ds_release_block(p_ds_buffer, alloc_idx);
+#if (DS_COALESCE_ON_FREE == 0u) && (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
+            if (DS_ALLOC_IDX_NONE != rest_idx) {
+                ds_merge_into_prev(p_ds_buffer, rest_idx); /* ds_release_block() leaves it split */
+            }
+#endif
+            p_memories[placed] = NULL;
+        }
+        p_ds_buffer->next_fit_offset = next_fit_offset;
+    }
+
+    return ret;
+}
+
+ds_err_code_t ds_free_batch(dynostatic_buffer_t *p_ds_buffer, void **p_memories, size_t count)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_memories) || (count == 0u)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    /* Check every entry before releasing any. A checked block keeps its
+     * DS_ALLOCATED status but loses its allocated_map bit, so a repeated
+     * entry is caught and the release pass below can find the batch from
+     * the map alone. */
+    ds_err_code_t ret = ERROR_DS_OK;
+
+    for (size_t i = 0u; (i < count) && (ERROR_DS_OK == ret); i++) {
+        size_t alloc_idx;
+
+        if (NULL == p_memories[i]) {
+            ret = ERROR_DS_INVALID_ARG;
+        } else {
+            ret = ds_find_allocator_for_memory(p_ds_buffer, p_memories[i], &alloc_idx);
+        }
+        if (ERROR_DS_OK != ret) {
+            continue;
+        }
+
+        const uint32_t bit = (uint32_t)1u << (alloc_idx % 32u);
+
+        if (0u == (p_ds_buffer->allocated_map[alloc_idx / 32u] & bit)) {
+            ret = ERROR_DS_ALLOCATOR_NOT_FOUND; /* same block as an earlier entry */
+#if DS_HANDLES == 1u
+        } else if (0u != (p_ds_buffer->handle_map[alloc_idx / 32u] & bit)) {
+            ret = ERROR_DS_INVALID_ARG; /* released by ds_hfree() only */
+#endif
+        } else {
+            p_ds_buffer->allocated_map[alloc_idx / 32u] &= ~bit;
+        }
+    }
+
+    if (ERROR_DS_OK != ret) {
+        ds_restore_allocated_map(p_ds_buffer);
+        return ret;
+    }
+
+    /* As in ds_group_free_all(): the tail block goes last, so one cascade
+     * rolls data_head back over the whole trailing run. */
+    const size_t tail = p_ds_buffer->tail_record;
+    bool tail_member = false;
+
+    for (size_t word = 0u; word < DS_BIT_WORDS(p_ds_buffer->record_count); word++) {
+        uint32_t marked = ~p_ds_buffer->allocated_map[word];
+
+        while (0u != marked) {
+            const size_t iter = (word * 32u) + ds_lowest_bit(marked);
+
+            marked &= marked - 1u;
+            if ((iter >= p_ds_buffer->record_count) || (DS_ALLOCATED != p_ds_buffer->allocators.allocation_status[iter])) {
+                continue; /* spare, parked or past the last record */
+            }
+            p_ds_buffer->allocated_map[word] |= (uint32_t)1u << (iter % 32u);
+            if (iter == tail) {
+                tail_member = true;
+            } else {
+                ds_release_block(p_ds_buffer, iter);
+            }
+        }
+    }
+
+    if (tail_member) {
+        ds_release_block(p_ds_buffer, tail);
+    }
+
+    for (size_t i = 0u; i < count; i++) {
+        p_memories[i] = NULL;
+    }
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_malloc_multi(dynostatic_buffer_t *p_ds_buffer, void **p_memories, const ds_multi_desc_t *p_descs, size_t count)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_memories) || (NULL == p_descs) || (count == 0u)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    /* Size the block before its address is known: the block start meets the
+     * instance's alignment, so a stricter sub-object may need up to
+     * (alignment - granule) bytes of padding on top of the granule rounding. */
+    const size_t granule = (size_t)1u << p_ds_buffer->granule_shift;
+    const size_t max_size = p_ds_buffer->max_allocation_size;
+    size_t total = 0u;
+
+    for (size_t i = 0u; i < count; i++) {
+        const size_t size = p_descs[i].size;
+        const size_t alignment = p_descs[i].alignment;
+
+        if ((size == 0u) || (alignment == 0u) || (0u != (alignment & (alignment - 1u)))
+            || ((i == 0u) && (alignment > granule))) {
+            return ERROR_DS_INVALID_ARG;
+        }
+        if ((size > max_size) || (alignment > max_size)) {
+            return ERROR_DS_TOO_BIG_CHUNK;
+        }
+
+        if (alignment <= granule) {
+            total = (total + (alignment - 1u)) & ~(alignment - 1u);
+        } else {
+            total = ds_align_up(p_ds_buffer, total) + (alignment - granule);
+        }
+        total += size;
+        if (total > max_size) {
+            return ERROR_DS_TOO_BIG_CHUNK; /* checked per step, so total never nears SIZE_MAX */
+        }
+    }
+
+    size_t alloc_idx;
+    ds_err_code_t ret = ds_find_allocator_for_memory(p_ds_buffer, p_memories[0], &alloc_idx);
+    if (ret == ERROR_DS_OK) {
+        return ERROR_DS_PTR_ALLOC_YET;
+    }
+
+    ret = ds_get_new_allocator(p_ds_buffer, total, &alloc_idx);
+    if (ret != ERROR_DS_OK) {
+        return ret;
+    }
+
+    uint8_t *const p_block = &p_ds_buffer->memory[p_ds_buffer->allocators.head[alloc_idx]];
+    size_t offset = 0u;
+
+    for (size_t i = 0u; i < count; i++) {
+        const size_t mask = p_descs[i].alignment - 1u;
+        /* cppcheck-suppress misra-c2012-11.4 ; deviation: alignment is a property of the address */
+        const uintptr_t addr = (uintptr_t)&p_block[offset];
+
+        offset += (size_t)((((addr + mask) & ~(uintptr_t)mask)) - addr);
+        p_memories[i] = &p_block[offset];
+        offset += p_descs[i].size;
+    }
+    DS_ASSERT(offset <= total);
+#if DS_TRACK_REQUESTED == 1u
+    ds_set_requested(p_ds_buffer, alloc_idx, offset); /* the padding reserved but unused is waste */
+#endif
+
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_reserve(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t max_size)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_memory) || (max_size == 0u)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    if (max_size > p_ds_buffer->max_allocation_size) {
+        return ERROR_DS_TOO_BIG_CHUNK;
+    }
+
+    size_t alloc_idx;
+    ds_err_code_t ret = ds_find_allocator_for_memory(p_ds_buffer, *p_memory, &alloc_idx);
+    if (ret == ERROR_DS_OK) {
+        return ERROR_DS_PTR_ALLOC_YET;
+    }
+
+#if (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
+    ret = ds_carve_fresh(p_ds_buffer, ds_fit_size(p_ds_buffer, max_size), &alloc_idx);
+    if (ret != ERROR_DS_OK) {
+        ret = ds_get_new_allocator(p_ds_buffer, max_size, &alloc_idx); /* reuse a parked block instead */
+    }
+#else
+    ret = ds_get_new_allocator(p_ds_buffer, max_size, &alloc_idx);
+#endif
+    if (ret != ERROR_DS_OK) {
+        return ret;
+    }
+#if DS_TRACK_REQUESTED == 1u
+    ds_set_requested(p_ds_buffer, alloc_idx, max_size);
+#endif
+
+    *p_memory = &p_ds_buffer->memory[p_ds_buffer->allocators.head[alloc_idx]];
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_commit(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t size)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_memory) || (NULL == *p_memory)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    if (size == 0u) {
+        return ds_free(p_ds_buffer, p_memory);
+    }
+
+    size_t alloc_idx;
+    const ds_err_code_t ret = ds_find_allocator_for_memory(p_ds_buffer, *p_memory, &alloc_idx);
+    if (ret != ERROR_DS_OK) {
+        return ret;
+    }
+
+#if DS_HANDLES == 1u
+    if (0u != (p_ds_buffer->handle_map[alloc_idx / 32u] & ((uint32_t)1u << (alloc_idx % 32u)))) {
+        return ERROR_DS_INVALID_ARG; /* fixed size, as for ds_realloc() */
+    }
+#endif
+
+    const size_t capacity = p_ds_buffer->allocators.size[alloc_idx];
+
+    if (size > capacity) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    /* Never grow to honour DS_FIT_ROUNDED's grid, as in ds_realloc(). */
+    const size_t aligned_size = ds_fit_size(p_ds_buffer, size);
+    if (aligned_size < capacity) {
+        ds_shrink_in_place(p_ds_buffer, alloc_idx, aligned_size);
+    }
+#if DS_TRACK_REQUESTED == 1u
+    ds_set_requested(p_ds_buffer, alloc_idx, size);
+#endif
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_usable_size(dynostatic_buffer_t *p_ds_buffer, const void *p_memory, size_t *p_usable_size)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_memory) || (NULL == p_usable_size)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    size_t alloc_idx;
+    const ds_err_code_t ret = ds_find_allocator_for_memory(p_ds_buffer, p_memory, &alloc_idx);
+    if (ret != ERROR_DS_OK) {
+        return ret;
+    }
+
+#if DS_TRACK_REQUESTED == 1u
+    ds_set_requested(p_ds_buffer, alloc_idx, p_ds_buffer->allocators.size[alloc_idx]); /* the caller may now fill it */
+#endif
+    *p_usable_size = p_ds_buffer->allocators.size[alloc_idx];
+    return ERROR_DS_OK;
+}
+
+#if DS_TRACK_REQUESTED == 1u
+ds_err_code_t ds_requested_size(const dynostatic_buffer_t *p_ds_buffer, const void *p_memory, size_t *p_requested_size)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_memory) || (NULL == p_requested_size)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    size_t alloc_idx;
+    const ds_err_code_t ret = ds_find_allocator_for_memory(p_ds_buffer, p_memory, &alloc_idx);
+    if (ret != ERROR_DS_OK) {
+        return ret;
+    }
+
+    *p_requested_size = p_ds_buffer->allocators.requested[alloc_idx];
+    return ERROR_DS_OK;
+}
+#endif
+
+ds_err_code_t ds_realloc_ex(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t min_size, size_t preferred_size, size_t *p_capacity)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_memory) || (NULL == p_capacity) || (min_size == 0u)
+        || (preferred_size < min_size)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    if (min_size > p_ds_buffer->max_allocation_size) {
+        return ERROR_DS_TOO_BIG_CHUNK;
+    }
+
+    size_t want = (preferred_size > p_ds_buffer->max_allocation_size) ? p_ds_buffer->max_allocation_size : preferred_size;
+    const bool resize = (NULL != *p_memory);
+    size_t alloc_idx = 0u;
+    ds_err_code_t ret;
+
+    if (resize) {
+        ret = ds_find_allocator_for_memory(p_ds_buffer, *p_memory, &alloc_idx);
+        if (ret != ERROR_DS_OK) {
+            return ret;
+        }
+
+#if DS_HANDLES == 1u
+        if (0u != (p_ds_buffer->handle_map[alloc_idx / 32u] & ((uint32_t)1u << (alloc_idx % 32u)))) {
+            return ERROR_DS_INVALID_ARG; /* fixed size, as for ds_realloc() */
+        }
+#endif
+
+        const size_t capacity = p_ds_buffer->allocators.size[alloc_idx];
+
+        if (min_size <= capacity) {
+#if DS_TRACK_REQUESTED == 1u
+            ds_set_requested(p_ds_buffer, alloc_idx, capacity);
+#endif
+            *p_capacity = capacity; /* room already: the whole point */
+            return ERROR_DS_OK;
+        }
+
+#if (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
+        /* A trailing block takes what the bump space has, up to the hint. */
+        const size_t head = p_ds_buffer->allocators.head[alloc_idx];
+        size_t room = p_ds_buffer->memory_size - head;
+
+        if ((head + capacity) == p_ds_buffer->data_head) {
+            room = (room > p_ds_buffer->max_allocation_size) ? p_ds_buffer->max_allocation_size : room;
+            room = ds_fit_size_floor(p_ds_buffer, room & ~(((size_t)1u << p_ds_buffer->granule_shift) - 1u));
+            if ((room >= min_size) && (room < want)) {
+                want = room;
+            }
+        }
+#endif
+
+        if (ds_grow_in_place(p_ds_buffer, alloc_idx, ds_fit_size(p_ds_buffer, want))
+            || ((want != min_size) && ds_grow_in_place(p_ds_buffer, alloc_idx, ds_fit_size(p_ds_buffer, min_size)))) {
+#if DS_TRACK_REQUESTED == 1u
+            ds_set_requested(p_ds_buffer, alloc_idx, p_ds_buffer->allocators.size[alloc_idx]);
+#endif
+            *p_capacity = p_ds_buffer->allocators.size[alloc_idx];
+            return ERROR_DS_OK;
+        }
+    }
+
+    /* New or moved block: the hint first, then the bare minimum. */
+    size_t new_idx;
+    ret = ds_get_new_allocator(p_ds_buffer, want, &new_idx);
+    if ((ret != ERROR_DS_OK) && (want != min_size)) {
+        ret = ds_get_new_allocator(p_ds_buffer, min_size, &new_idx);
+    }
+    if (ret != ERROR_DS_OK) {
+        return ret;
+    }
+
+    void *const p_new = &p_ds_buffer->memory[p_ds_buffer->allocators.head[new_idx]];
+
+    if (resize) {
+#if DS_GROUPS == 1u
+        p_ds_buffer->allocators.group[new_idx] = p_ds_buffer->allocators.group[alloc_idx]; /* still a member */
+#endif
+#if DS_TRACK_REQUESTED == 1u
+        ds_memcpy(p_new, p_ds_buffer->allocators.size[new_idx], *p_memory, p_ds_buffer->allocators.requested[alloc_idx]);
+#else
+        ds_memcpy(p_new, p_ds_buffer->allocators.size[new_idx], *p_memory, p_ds_buffer->allocators.size[alloc_idx]);
+#endif
+        ds_release_block(p_ds_buffer, alloc_idx); /* zeroes old block under DS_ZERO_ON_FREE; may cascade */
+    }
+#if DS_TRACK_REQUESTED == 1u
+    ds_set_requested(p_ds_buffer, new_idx, p_ds_buffer->allocators.size[new_idx]); /* all of it is the caller's */
+#endif
+
+    *p_memory = p_new;
+    *p_capacity = p_ds_buffer->allocators.size[new_idx];
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_get_memory_usage(const dynostatic_buffer_t *p_ds_buffer, uint8_t *p_memory_usage)
+{
+    if ((NULL == p_ds_buffer) || (p_memory_usage == NULL)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    const size_t usage = p_ds_buffer->used_bytes;
+
+    /* LCOV_EXCL_START: Unreachable while allocator invariants hold — corrupted-state guard
+        * by design; excluded from coverage rather than pretend-tested. */
+    if (usage > p_ds_buffer->memory_size) {
+        *p_memory_usage = 0;
+        return ERROR_DS_CRITICAL_ERR;
+    }
+    /* LCOV_EXCL_STOP */
+
+    *p_memory_usage = (uint8_t)((100u * usage) / p_ds_buffer->memory_size);
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_get_memory_usage_bytes(const dynostatic_buffer_t *p_ds_buffer, size_t *p_memory_usage_bytes)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_memory_usage_bytes)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    *p_memory_usage_bytes = p_ds_buffer->used_bytes;
+    return ERROR_DS_OK;
+}
+
+#if DS_TRACK_REQUESTED == 1u
+ds_err_code_t ds_get_requested_bytes(const dynostatic_buffer_t *p_ds_buffer, size_t *p_requested_bytes)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_requested_bytes)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    *p_requested_bytes = p_ds_buffer->requested_bytes;
+    return ERROR_DS_OK;
+}
+#endif
+
+ds_err_code_t ds_get_max_new_allocation_size(const dynostatic_buffer_t *p_ds_buffer, size_t *p_max_new_allocation)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_max_new_allocation)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    size_t max_size = 0u;
+
+    if (p_ds_buffer->used_allocators < p_ds_buffer->record_count) {
+#if DS_ENGINE == DS_ENGINE_BITMAP
+        /* Every free run is fresh space, and a spare record always exists here. */
+        max_size = ds_bitmap_largest_run(p_ds_buffer) << p_ds_buffer->granule_shift;
+        if (max_size > p_ds_buffer->max_allocation_size) {
+            max_size = p_ds_buffer->max_allocation_size;
+        }
+#else
+        /* Reuse candidate: the largest capacity reuse can hand out, kept
+         * current by the free lists. Merged blocks may exceed the
+         * per-request cap. */
+        max_size = ds_largest_reusable(p_ds_buffer);
+        if (max_size > p_ds_buffer->max_allocation_size) {
+            max_size = p_ds_buffer->max_allocation_size;
+        }
+
+        /* Bump candidate exists only if a DS_NOT_USED slot does. */
+        if ((p_ds_buffer->used_allocators + p_ds_buffer->parked_allocators) < p_ds_buffer->record_count) {
+#if DS_ENGINE == DS_ENGINE_BUDDY
+            size_t bump_max = ds_buddy_frontier_chunk(p_ds_buffer);
+#else
+            const size_t remaining = p_ds_buffer->memory_size - p_ds_buffer->data_head;
+            /* data_head is alignment-multiple, so only an unaligned buffer
+             * tail can make `remaining` unaligned; that tail is unusable. */
+            size_t bump_max = remaining - (remaining & (((size_t)1u << p_ds_buffer->granule_shift) - 1u));
+#endif
+            if (bump_max > p_ds_buffer->max_allocation_size) {
+                bump_max = p_ds_buffer->max_allocation_size;
+            }
+            if (bump_max > max_size) {
+                max_size = bump_max;
+            }
+        }
+#endif
+    }
+
+    /* Under DS_FIT_ROUNDED a request needs its grid capacity, not just its size. */
+    *p_max_new_allocation = ds_fit_size_floor(p_ds_buffer, max_size);
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_get_free_allocator_cnt(const dynostatic_buffer_t *p_ds_buffer, size_t *p_free_allocators)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_free_allocators)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    *p_free_allocators = p_ds_buffer->record_count - p_ds_buffer->used_allocators;
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_set_fit_policy(dynostatic_buffer_t *p_ds_buffer, ds_fit_policy_t policy)
+{
+    if ((NULL == p_ds_buffer) || (policy < DS_FIT_SEGREGATED) || (policy > DS_FIT_ROUNDED)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    p_ds_buffer->fit_policy = (uint8_t)policy;
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_coalesce(dynostatic_buffer_t *p_ds_buffer)
+{
+    if (NULL == p_ds_buffer) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
+        return ERROR_DS_NO_INIT;
+    }
+
+#if (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
+    /* Walk down from the tail; merging into the predecessor keeps the walk
+     * on the survivor, so a whole run folds into its lowest block. */
+    size_t iter = p_ds_buffer->tail_record;
+
+    while (DS_ALLOC_IDX_NONE != iter) {
+        const size_t prev_idx = p_ds_buffer->allocators.prev_phys[iter];
+
+        if ((DS_FREE == p_ds_buffer->allocators.allocation_status[iter]) && (DS_ALLOC_IDX_NONE != prev_idx)
+            && (DS_FREE == p_ds_buffer->allocators.allocation_status[prev_idx])) {
+            ds_merge_into_prev(p_ds_buffer, iter);
+        }
+        iter = prev_idx;
+    }
+#endif
+
+    return ERROR_DS_OK;
+}
+
+#if DS_HANDLES == 1u
+ds_err_code_t ds_halloc(dynostatic_buffer_t *p_ds_buffer, ds_handle_t *p_handle, size_t size)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_handle) || (size == 0u)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    if (size > p_ds_buffer->max_allocation_size) {
+        return ERROR_DS_TOO_BIG_CHUNK;
+    }
+
+    size_t alloc_idx;
+    const ds_err_code_t ret = ds_get_new_allocator(p_ds_buffer, size, &alloc_idx);
+    if (ret != ERROR_DS_OK) {
+        return ret;
+    }
+
+    uint16_t generation = (uint16_t)(p_ds_buffer->allocators.generation[alloc_idx] + 1u);
+    if (0u == generation) {
+        generation = 1u; /* wrapped: 0 would let DS_HANDLE_NONE name record 0 */
     }
 
-    return ERROR_DS_ALLOCATOR_NOT_FOUND;
+    p_ds_buffer->allocators.generation[alloc_idx] = generation;
+    p_ds_buffer->allocators.lock_count[alloc_idx] = 0u;
+    p_ds_buffer->handle_map[alloc_idx / 32u] |= (uint32_t)1u << (alloc_idx % 32u);
+
+    *p_handle = ((ds_handle_t)generation << 16u) | (ds_handle_t)alloc_idx;
+    return ERROR_DS_OK;
 }
 
-static void ds_reclaim_trailing(dynostatic_buffer_t *p_ds_buffer, size_t alloc_idx)
+ds_err_code_t ds_hfree(dynostatic_buffer_t *p_ds_buffer, ds_handle_t *p_handle)
 {
-    size_t idx = alloc_idx;
-    bool cascade = true;
+    if ((NULL == p_ds_buffer) || (NULL == p_handle) || (DS_HANDLE_NONE == *p_handle)) {
+        return ERROR_DS_INVALID_ARG;
+    }
 
-    while (cascade) {
-        p_ds_buffer->data_head = p_ds_buffer->allocators[idx].head;
-        p_ds_buffer->allocators[idx].allocation_status = DS_NOT_USED;
-        p_ds_buffer->allocators[idx].head = 0u;
-        p_ds_buffer->allocators[idx].size = 0u;
+    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
+        return ERROR_DS_NO_INIT;
+    }
 
-        if ((0u == idx) || (DS_FREE != p_ds_buffer->allocators[idx - 1u].allocation_status)) {
-            cascade = false;
-        } else {
-            idx--;
-        }
+    size_t alloc_idx;
+    if (!ds_handle_record(p_ds_buffer, *p_handle, &alloc_idx)) {
+        return ERROR_DS_STALE_HANDLE;
     }
+
+    if (0u != p_ds_buffer->allocators.lock_count[alloc_idx]) {
+        return ERROR_DS_HANDLE_LOCKED;
+    }
+
+    /* Clearing the bit makes every copy of the handle stale and lets ds_free() take the block. */
+    p_ds_buffer->handle_map[alloc_idx / 32u] &= ~((uint32_t)1u << (alloc_idx % 32u));
+
+    void *p_memory = &p_ds_buffer->memory[p_ds_buffer->allocators.head[alloc_idx]];
+    const ds_err_code_t ret = ds_free(p_ds_buffer, &p_memory);
+    DS_ASSERT(ret == ERROR_DS_OK);
+    (void)ret;
+
+    *p_handle = DS_HANDLE_NONE;
+    return ERROR_DS_OK;
 }
 
-/*---Public-Function-Implementation---*/
+ds_err_code_t ds_hlock(dynostatic_buffer_t *p_ds_buffer, ds_handle_t handle, void **p_memory)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_memory) || (DS_HANDLE_NONE == handle)) {
+        return ERROR_DS_INVALID_ARG;
+    }
 
-ds_err_code_t ds_initialize_allocation(dynostatic_buffer_t *p_ds_buffer)
+    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    size_t alloc_idx;
+    if (!ds_handle_record(p_ds_buffer, handle, &alloc_idx)) {
+        return ERROR_DS_STALE_HANDLE;
+    }
+
+    if (UINT8_MAX == p_ds_buffer->allocators.lock_count[alloc_idx]) {
+        return ERROR_DS_HANDLE_LOCKED;
+    }
+
+    p_ds_buffer->allocators.lock_count[alloc_idx]++;
+    *p_memory = &p_ds_buffer->memory[p_ds_buffer->allocators.head[alloc_idx]];
+    return ERROR_DS_OK;
+}
+
+ds_err_code_t ds_hunlock(dynostatic_buffer_t *p_ds_buffer, ds_handle_t handle)
 {
-    if (NULL == p_ds_buffer) {
+    if ((NULL == p_ds_buffer) || (DS_HANDLE_NONE == handle)) {
         return ERROR_DS_INVALID_ARG;
     }
 
-    if (p_ds_buffer->init_magic == DS_MAGIC_NUMBER) {
-        return ERROR_DS_ALREADY_INIT;
+    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
+        return ERROR_DS_NO_INIT;
     }
 
-    p_ds_buffer->init_magic = DS_MAGIC_NUMBER;
-    p_ds_buffer->data_head = 0;
-    p_ds_buffer->used_allocators = 0;
+    size_t alloc_idx;
+    if (!ds_handle_record(p_ds_buffer, handle, &alloc_idx)) {
+        return ERROR_DS_STALE_HANDLE;
+    }
 
-    ds_zero(p_ds_buffer->memory, DS_BUFFER_MEMORY_SIZE, DS_BUFFER_MEMORY_SIZE);
-    ds_zero(p_ds_buffer->allocators, sizeof(p_ds_buffer->allocators), sizeof(p_ds_buffer->allocators));
+    if (0u == p_ds_buffer->allocators.lock_count[alloc_idx]) {
+        return ERROR_DS_INVALID_ARG;
+    }
 
+    p_ds_buffer->allocators.lock_count[alloc_idx]--;
     return ERROR_DS_OK;
 }
 
-ds_err_code_t ds_malloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t size)
+ds_err_code_t ds_compact_step(dynostatic_buffer_t *p_ds_buffer, size_t budget, size_t *p_moved_bytes)
 {
-    if ((NULL == p_ds_buffer) || (NULL == p_memory) || (size == 0u)) {
+    if ((NULL == p_ds_buffer) || (NULL == p_moved_bytes)) {
         return ERROR_DS_INVALID_ARG;
     }
 
-    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    size_t moved = 0u;
+    bool progress = true;
+
+    /* Every move lowers a head, so the passes end; one that moves nothing
+     * proves the blocks are as low as they go. */
+    while (progress) {
+        progress = false;
+
+        for (size_t word = 0u; word < DS_BIT_WORDS(p_ds_buffer->record_count); word++) {
+            uint32_t movable = p_ds_buffer->handle_map[word];
+
+            while (0u != movable) {
+                const size_t alloc_idx = (word * 32u) + ds_lowest_bit(movable);
+                const size_t size = p_ds_buffer->allocators.size[alloc_idx];
+
+                movable &= movable - 1u; /* clear the visited bit */
+                if (0u != p_ds_buffer->allocators.lock_count[alloc_idx]) {
+                    continue;
+                }
+                if ((0u != moved) && ((moved >= budget) || (size > (budget - moved)))) {
+                    *p_moved_bytes = moved;
+                    return ERROR_DS_OK;
+                }
+                if (ds_compact_block(p_ds_buffer, alloc_idx)) {
+                    moved += size;
+                    progress = true;
+                }
+            }
+        }
+    }
+
+    *p_moved_bytes = moved;
+    return ERROR_DS_OK;
+}
+#endif
+
+ds_err_code_t ds_pool_create(dynostatic_buffer_t *p_ds_buffer, ds_pool_t *p_pool, size_t slot_size, size_t slot_count)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_pool) || (0u == slot_size) || (0u == slot_count)) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+    if (NULL != p_pool->p_ds_buffer) {
+        return ERROR_DS_ALREADY_INIT;
+    }
+
+    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
         return ERROR_DS_NO_INIT;
     }
 
-    if (size > DS_MAX_ALLOCATION_SIZE) {
+    /* Checked before rounding, so neither the rounding nor the product can wrap. */
+    if ((slot_count >= DS_POOL_SLOT_NONE) || (slot_size > p_ds_buffer->max_allocation_size)) {
         return ERROR_DS_TOO_BIG_CHUNK;
     }
 
-    size_t alloc_idx;
-    ds_err_code_t ret = ds_find_allocator_for_memory(p_ds_buffer, *p_memory, &alloc_idx);
-    if (ret == ERROR_DS_OK) {
-        return ERROR_DS_PTR_ALLOC_YET;
+    const size_t aligned_slot = ds_align_up(p_ds_buffer, slot_size);
+    const size_t map_size = DS_BIT_WORDS(slot_count) * sizeof(uint32_t);
+
+    if ((map_size > p_ds_buffer->max_allocation_size)
+        || (slot_count > ((p_ds_buffer->max_allocation_size - map_size) / aligned_slot))) {
+        return ERROR_DS_TOO_BIG_CHUNK;
     }
 
-    ret = ds_get_new_allocator(p_ds_buffer, size, &alloc_idx);
-    if (ret != ERROR_DS_OK) {
+    void *p_block = NULL;
+    const ds_err_code_t ret = ds_malloc(p_ds_buffer, &p_block, (aligned_slot * slot_count) + map_size);
+
+    if (ERROR_DS_OK != ret) {
         return ret;
     }
 
-    *p_memory = &p_ds_buffer->memory[p_ds_buffer->allocators[alloc_idx].head];
+    p_pool->p_ds_buffer = p_ds_buffer;
+    p_pool->p_slots = p_block;
+    /* Slot sizes are multiples of the alignment, itself at least alignof(uint32_t).
+     * The map is not cleared: bits of slots past fresh are never read. */
+    p_pool->p_in_use = (void *)&p_pool->p_slots[aligned_slot * slot_count];
+    p_pool->slot_size = aligned_slot;
+    p_pool->slot_count = (uint32_t)slot_count;
+    p_pool->fresh = 0u;
+    p_pool->free_head = DS_POOL_SLOT_NONE;
+    p_pool->free_count = (uint32_t)slot_count;
     return ERROR_DS_OK;
 }
 
-ds_err_code_t ds_free(dynostatic_buffer_t *p_ds_buffer, void **p_memory)
+ds_err_code_t ds_pool_alloc(ds_pool_t *p_pool, void **p_memory)
 {
-    if ((NULL == p_ds_buffer) || (NULL == p_memory) || (NULL == *p_memory)) {
+    if ((NULL == p_pool) || (NULL == p_memory)) {
         return ERROR_DS_INVALID_ARG;
     }
 
-    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+    if (NULL == p_pool->p_ds_buffer) {
         return ERROR_DS_NO_INIT;
     }
 
-    size_t alloc_idx;
-    ds_err_code_t ret = ds_find_allocator_for_memory(p_ds_buffer, *p_memory, &alloc_idx);
-    if (ret != ERROR_DS_OK) {
-        return ret;
+    if (0u == p_pool->free_count) {
+        return ERROR_DS_NO_MEMORY;
     }
 
-    const size_t head = p_ds_buffer->allocators[alloc_idx].head;
-    const size_t size = p_ds_buffer->allocators[alloc_idx].size;
-
-#if DS_ZERO_ON_FREE == 1u
-    ds_zero(&p_ds_buffer->memory[head], DS_BUFFER_MEMORY_SIZE - head, size);
-#endif
+    uint32_t slot;
 
-    if ((head + size) == p_ds_buffer->data_head) {
-        ds_reclaim_trailing(p_ds_buffer, alloc_idx);
+    /* Released slots first, so fresh ones stay untouched as long as possible. */
+    if (DS_POOL_SLOT_NONE != p_pool->free_head) {
+        slot = p_pool->free_head;
+        ds_memcpy(&p_pool->free_head, sizeof(p_pool->free_head), &p_pool->p_slots[(size_t)slot * p_pool->slot_size],
+                  sizeof(p_pool->free_head));
     } else {
-        p_ds_buffer->allocators[alloc_idx].allocation_status = DS_FREE;
+        slot = p_pool->fresh;
+        p_pool->fresh++;
     }
 
-    p_ds_buffer->used_allocators--;
-    *p_memory = NULL;
+    p_pool->p_in_use[slot / 32u] |= (uint32_t)1u << (slot % 32u);
+    p_pool->free_count--;
+    *p_memory = &p_pool->p_slots[(size_t)slot * p_pool->slot_size];
     return ERROR_DS_OK;
 }
 
-ds_err_code_t ds_calloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t len, size_t size_of_elem)
+ds_err_code_t ds_pool_free(ds_pool_t *p_pool, void **p_memory)
 {
-    if ((NULL == p_ds_buffer) || (NULL == p_memory) || (len == 0u) || (size_of_elem == 0u)) {
+    if ((NULL == p_pool) || (NULL == p_memory) || (NULL == *p_memory)) {
         return ERROR_DS_INVALID_ARG;
     }
 
-    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+    if (NULL == p_pool->p_ds_buffer) {
         return ERROR_DS_NO_INIT;
     }
 
-    size_t total_size = len * size_of_elem;
-    if ((total_size / len) != size_of_elem) { /* Check for overflow */
-        return ERROR_DS_INVALID_ARG;
+    /* cppcheck-suppress misra-c2012-11.6 ; deviation: integer comparison is the
+     * defined-behaviour alternative to relational comparison of unrelated pointers */
+    const uintptr_t addr = (uintptr_t)*p_memory;
+    /* cppcheck-suppress misra-c2012-11.4 ; deviation: as above */
+    const uintptr_t start = (uintptr_t)p_pool->p_slots;
+
+    if ((addr < start) || ((addr - start) >= ((uintptr_t)p_pool->slot_count * p_pool->slot_size))) {
+        return ERROR_DS_MEMORY_OUT_OF_DS;
     }
 
-    ds_err_code_t ret = ds_malloc(p_ds_buffer, p_memory, total_size);
-    if (ret != ERROR_DS_OK) {
-        return ret;
+    const size_t offset = (size_t)(addr - start);
+    const uint32_t slot = (uint32_t)(offset / p_pool->slot_size);
+
+    if ((0u != (offset % p_pool->slot_size)) || (slot >= p_pool->fresh)) {
+        return ERROR_DS_ALLOCATOR_NOT_FOUND;
+    }
+
+    const uint32_t bit = (uint32_t)1u << (slot % 32u);
+
+    if (0u == (p_pool->p_in_use[slot / 32u] & bit)) {
+        return ERROR_DS_ALLOCATOR_NOT_FOUND; /* released already */
     }
+    p_pool->p_in_use[slot / 32u] &= ~bit;
 
-    ds_zero(*p_memory, ds_align_up(total_size), total_size);
+    uint8_t *const p_slot = &p_pool->p_slots[offset];
+
+#if DS_ZERO_ON_FREE == 1u
+    ds_zero(&p_slot[sizeof(p_pool->free_head)], p_pool->slot_size - sizeof(p_pool->free_head),
+            p_pool->slot_size - sizeof(p_pool->free_head));
+#endif
+    ds_memcpy(p_slot, p_pool->slot_size, &p_pool->free_head, sizeof(p_pool->free_head));
+    p_pool->free_head = slot;
+    p_pool->free_count++;
+    *p_memory = NULL;
     return ERROR_DS_OK;
 }
 
-ds_err_code_t ds_realloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t size)
+ds_err_code_t ds_pool_destroy(ds_pool_t *p_pool)
 {
-    if ((NULL == p_ds_buffer) || (NULL == p_memory)) {
+    if (NULL == p_pool) {
         return ERROR_DS_INVALID_ARG;
     }
 
-    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
+    if (NULL == p_pool->p_ds_buffer) {
         return ERROR_DS_NO_INIT;
     }
 
-    if (size == 0u) {
-        return ds_free(p_ds_buffer, p_memory);
+    void *p_block = p_pool->p_slots;
+    ds_err_code_t ret = ds_free(p_pool->p_ds_buffer, &p_block);
+
+    /* A deinitialized instance took the block with it. Any other failure means
+     * no block of ours starts there: it was released behind the pool's back. */
+    if ((ERROR_DS_OK != ret) && (ERROR_DS_NO_INIT != ret)) {
+        ret = ERROR_DS_ALLOCATOR_NOT_FOUND;
     }
 
-    if (*p_memory == NULL) {
-        return ds_malloc(p_ds_buffer, p_memory, size);
+    /* The pool is gone either way. */
+    ds_zero(p_pool, sizeof(*p_pool), sizeof(*p_pool));
+    return ret;
+}
+
+#if DS_GROUPS == 1u
+ds_err_code_t ds_group_init(dynostatic_buffer_t *p_ds_buffer, ds_group_t *p_group)
+{
+    if ((NULL == p_ds_buffer) || (NULL == p_group)) {
+        return ERROR_DS_INVALID_ARG;
     }
 
-    if (size > DS_MAX_ALLOCATION_SIZE) {
-        return ERROR_DS_TOO_BIG_CHUNK;
+    if (NULL != p_group->p_ds_buffer) {
+        return ERROR_DS_ALREADY_INIT;
     }
 
-    size_t alloc_idx;
-    ds_err_code_t ret = ds_find_allocator_for_memory(p_ds_buffer, *p_memory, &alloc_idx);
-    if (ret != ERROR_DS_OK) {
-        return ret; /* OUT_OF_DS / ALLOCATOR_NOT_FOUND — original contract bug fixed */
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+        return ERROR_DS_NO_INIT;
     }
 
-    const size_t head = p_ds_buffer->allocators[alloc_idx].head;
-    const size_t capacity = p_ds_buffer->allocators[alloc_idx].size;
-    const size_t aligned_size = ds_align_up(size);
+    /* Fewer live blocks than tags (a header static assert), so this ends. */
+    uint16_t tag = p_ds_buffer->last_group;
+    do {
+        tag++;
+        if (0u == tag) {
+            tag = 1u; /* 0 marks blocks outside any group */
+        }
+    } while (ds_group_tag_in_use(p_ds_buffer, tag));
+
+    p_ds_buffer->last_group = tag;
+    p_group->p_ds_buffer = p_ds_buffer;
+    p_group->tag = tag;
+    return ERROR_DS_OK;
+}
 
-    if (aligned_size <= capacity) {
-        return ERROR_DS_OK; /* shrink or fit: in place, capacity retained (no split) */
+ds_err_code_t ds_group_malloc(ds_group_t *p_group, void **p_memory, size_t size)
+{
+    if ((NULL == p_group) || (NULL == p_memory) || (size == 0u)) {
+        return ERROR_DS_INVALID_ARG;
     }
 
-    /* Trailing-block fast path: grow in place by advancing the bump head. */
-    if (((head + capacity) == p_ds_buffer->data_head)
-        && ((DS_BUFFER_MEMORY_SIZE - head) >= aligned_size)) {
-        p_ds_buffer->data_head = head + aligned_size;
-        p_ds_buffer->allocators[alloc_idx].size = aligned_size;
-        return ERROR_DS_OK;
+    dynostatic_buffer_t *const p_ds_buffer = p_group->p_ds_buffer;
+
+    if ((NULL == p_ds_buffer) || (p_ds_buffer->init_magic != DS_MAGIC_NUMBER)) {
+        return ERROR_DS_NO_INIT;
     }
 
-    /* Move path: allocate FIRST, so any failure leaves the original intact. */
-    void *p_new = NULL;
-    ret = ds_malloc(p_ds_buffer, &p_new, size);
-    if (ret != ERROR_DS_OK) {
-        return ret;
+    if (size > p_ds_buffer->max_allocation_size) {
+        return ERROR_DS_TOO_BIG_CHUNK;
     }
 
-    ds_memcpy(p_new, aligned_size, *p_memory, capacity);
+    size_t alloc_idx;
+    ds_err_code_t ret = ds_find_allocator_for_memory(p_ds_buffer, *p_memory, &alloc_idx);
+    if (ret == ERROR_DS_OK) {
+        return ERROR_DS_PTR_ALLOC_YET;
+    }
 
-    ret = ds_free(p_ds_buffer, p_memory); /* zeroes old block under DS_ZERO_ON_FREE; may cascade */
-    DS_ASSERT(ret == ERROR_DS_OK);
-    (void)ret;
+    ret = ds_get_new_allocator(p_ds_buffer, size, &alloc_idx);
+    if (ret != ERROR_DS_OK) {
+        return ret;
+    }
 
-    *p_memory = p_new;
+    p_ds_buffer->allocators.group[alloc_idx] = p_group->tag;
+    *p_memory = &p_ds_buffer->memory[p_ds_buffer->allocators.head[alloc_idx]];
     return ERROR_DS_OK;
 }
 
-ds_err_code_t ds_get_memory_usage(const dynostatic_buffer_t *p_ds_buffer, uint8_t *p_memory_usage)
+ds_err_code_t ds_group_free_all(ds_group_t *p_group)
 {
-    size_t usage = 0;
-    if ((NULL == p_ds_buffer) || (p_memory_usage == NULL)) {
+    if (NULL == p_group) {
         return ERROR_DS_INVALID_ARG;
     }
 
+    dynostatic_buffer_t *const p_ds_buffer = p_group->p_ds_buffer;
+
+    if (NULL == p_ds_buffer) {
+        return ERROR_DS_NO_INIT;
+    }
+
     if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+        ds_zero(p_group, sizeof(*p_group), sizeof(*p_group)); /* deinit took the members with it */
         return ERROR_DS_NO_INIT;
     }
 
-    for (size_t iter = 0; iter < DS_MAX_ALLOCATION_COUNT; iter++) {
-        if (p_ds_buffer->allocators[iter].allocation_status == DS_ALLOCATED) {
-            usage += p_ds_buffer->allocators[iter].size;
+    /* Park every member but the tail block; releasing that one last then
+     * rolls data_head back over the whole trailing run at once. Bits of
+     * this word's copy are only ever cleared for records already visited. */
+    const size_t tail = p_ds_buffer->tail_record;
+    bool tail_member = false;
+
+    for (size_t word = 0u; word < DS_BIT_WORDS(p_ds_buffer->record_count); word++) {
+        uint32_t live = p_ds_buffer->allocated_map[word];
+
+        while (0u != live) {
+            const size_t iter = (word * 32u) + ds_lowest_bit(live);
+
+            live &= live - 1u;
+            if (p_group->tag != p_ds_buffer->allocators.group[iter]) {
+                continue;
+            }
+            if (iter == tail) {
+                tail_member = true;
+            } else {
+                ds_release_block(p_ds_buffer, iter);
+            }
         }
     }
 
-    /* LCOV_EXCL_START: Unreachable while allocator invariants hold — corrupted-state guard
-        * by design; excluded from coverage rather than pretend-tested. */
-    if (usage > DS_BUFFER_MEMORY_SIZE) {
-        *p_memory_usage = 0;
-        return ERROR_DS_CRITICAL_ERR;
+    if (tail_member) {
+        ds_release_block(p_ds_buffer, tail);
     }
-    /* LCOV_EXCL_STOP */
 
-    *p_memory_usage = (uint8_t)((100u * usage) / DS_BUFFER_MEMORY_SIZE);
+    ds_zero(p_group, sizeof(*p_group), sizeof(*p_group));
     return ERROR_DS_OK;
 }
+#endif
 
-ds_err_code_t ds_get_max_new_allocation_size(const dynostatic_buffer_t *p_ds_buffer, size_t *p_max_new_allocation)
+ds_err_code_t ds_get_mark(const dynostatic_buffer_t *p_ds_buffer, ds_mark_t *p_mark)
 {
-    if ((NULL == p_ds_buffer) || (NULL == p_max_new_allocation)) {
+    if ((NULL == p_ds_buffer) || (NULL == p_mark)) {
         return ERROR_DS_INVALID_ARG;
     }
 
-    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
         return ERROR_DS_NO_INIT;
     }
 
-    size_t max_size = 0u;
+    *p_mark = p_ds_buffer->data_head;
+    return ERROR_DS_OK;
+}
 
-    if (p_ds_buffer->used_allocators < DS_MAX_ALLOCATION_COUNT) {
-        bool bump_slot_available = false;
+ds_err_code_t ds_release_to_mark(dynostatic_buffer_t *p_ds_buffer, ds_mark_t mark)
+{
+    if (NULL == p_ds_buffer) {
+        return ERROR_DS_INVALID_ARG;
+    }
 
-        /* Reuse candidate: the largest parked DS_FREE capacity.
-         * Bump candidate exists only if a DS_NOT_USED slot does. */
-        for (size_t iter = 0u; iter < DS_MAX_ALLOCATION_COUNT; iter++) {
-            const ds_allocator_status_t status = p_ds_buffer->allocators[iter].allocation_status;
-            if (status == DS_NOT_USED) {
-                bump_slot_available = true;
-                break; /* compact prefix: nothing lives past this point */
-            }
-            if ((status == DS_FREE) && (p_ds_buffer->allocators[iter].size > max_size)) {
-                max_size = p_ds_buffer->allocators[iter].size;
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
+        return ERROR_DS_NO_INIT;
+    }
+
+    if ((mark > p_ds_buffer->memory_size) || (mark != ds_align_up(p_ds_buffer, mark))) {
+        return ERROR_DS_INVALID_ARG;
+    }
+
+#if (DS_ENGINE == DS_ENGINE_BUDDY) || (DS_ENGINE == DS_ENGINE_BITMAP)
+    /* Blocks above the mark are not a suffix of any chain here: buddies must
+     * merge back and granules are placed anywhere, so each is released as
+     * ds_free() would, minus the lookup. */
+    for (size_t word = 0u; word < DS_BIT_WORDS(p_ds_buffer->record_count); word++) {
+        uint32_t live = p_ds_buffer->allocated_map[word]; /* releasing only clears bits already visited */
+
+        while (0u != live) {
+            const size_t iter = (word * 32u) + ds_lowest_bit(live);
+
+            live &= live - 1u;
+            if (p_ds_buffer->allocators.head[iter] >= mark) {
+#if DS_HANDLES == 1u
+                p_ds_buffer->handle_map[word] &= ~((uint32_t)1u << (iter % 32u));
+#endif
+                ds_release_block(p_ds_buffer, iter);
             }
         }
+    }
+#else
+    /* The physical chain tiles [0, data_head), so the blocks above the mark
+     * are its suffix: drop them from the tail, live or parked. */
+    ds_allocator_t *const p_records = &p_ds_buffer->allocators;
+    size_t iter = p_ds_buffer->tail_record;
 
-        if (bump_slot_available) {
-            const size_t remaining = DS_BUFFER_MEMORY_SIZE - p_ds_buffer->data_head;
-            /* data_head is alignment-multiple, so only an unaligned buffer
-             * tail can make `remaining` unaligned; that tail is unusable. */
-            size_t bump_max = remaining - (remaining % DS_ALIGNMENT);
-            if (bump_max > DS_MAX_ALLOCATION_SIZE) {
-                bump_max = DS_MAX_ALLOCATION_SIZE;
-            }
-            if (bump_max > max_size) {
-                max_size = bump_max;
-            }
+    while ((DS_ALLOC_IDX_NONE != iter) && (p_records->head[iter] >= mark)) {
+        if (DS_FREE == p_records->allocation_status[iter]) {
+            ds_free_list_unlink(p_ds_buffer, iter);
+            p_ds_buffer->parked_allocators--;
+        } else {
+#if DS_ZERO_ON_FREE == 1u
+            ds_zero(&p_ds_buffer->memory[p_records->head[iter]], p_ds_buffer->memory_size - p_records->head[iter],
+                    p_records->size[iter]);
+#endif
+#if DS_HANDLES == 1u
+            p_ds_buffer->handle_map[iter / 32u] &= ~((uint32_t)1u << (iter % 32u));
+#endif
+            p_ds_buffer->used_allocators--;
         }
+
+        p_ds_buffer->data_head = p_records->head[iter];
+        ds_phys_unlink(p_ds_buffer, iter);
+        ds_set_status(p_ds_buffer, iter, DS_NOT_USED);
+        p_records->head[iter] = 0u;
+        p_records->size[iter] = 0u;
+        iter = p_ds_buffer->tail_record;
+    }
+
+    if ((DS_ALLOC_IDX_NONE != iter) && (DS_FREE == p_records->allocation_status[iter])) {
+        ds_free_list_unlink(p_ds_buffer, iter);
+        p_ds_buffer->parked_allocators--;
+        ds_reclaim_trailing(p_ds_buffer, iter);
     }
+#endif
 
-    *p_max_new_allocation = max_size;
     return ERROR_DS_OK;
 }
 
-ds_err_code_t ds_get_free_allocator_cnt(const dynostatic_buffer_t *p_ds_buffer, size_t *p_free_allocators)
+ds_err_code_t ds_reset(dynostatic_buffer_t *p_ds_buffer)
 {
-    if ((NULL == p_ds_buffer) || (NULL == p_free_allocators)) {
+    if (NULL == p_ds_buffer) {
         return ERROR_DS_INVALID_ARG;
     }
 
-    if (DS_MAGIC_NUMBER != p_ds_buffer->init_magic) {
+    if (p_ds_buffer->init_magic != DS_MAGIC_NUMBER) {
         return ERROR_DS_NO_INIT;
     }
 
-    *p_free_allocators = DS_MAX_ALLOCATION_COUNT - p_ds_buffer->used_allocators;
+    const size_t records = p_ds_buffer->record_count;
+    const size_t map_size = DS_BIT_WORDS(records) * sizeof(uint32_t);
+
+#if DS_ZERO_ON_FREE == 1u
+    ds_zero(p_ds_buffer->memory, p_ds_buffer->memory_size, p_ds_buffer->data_head);
+#endif
+    /* Free and physical links and the owner map are rewritten before they
+     * are read again, so only what a DS_NOT_USED record must hold is cleared. */
+    ds_zero(p_ds_buffer->allocators.head, records * sizeof(ds_offset_t), records * sizeof(ds_offset_t));
+    ds_zero(p_ds_buffer->allocators.size, records * sizeof(ds_offset_t), records * sizeof(ds_offset_t));
+    ds_zero(p_ds_buffer->allocators.allocation_status, records, records);
+    ds_zero(p_ds_buffer->allocated_map, map_size, map_size);
+    ds_zero(p_ds_buffer->parked_map, map_size, map_size);
+#if DS_HANDLES == 1u
+    ds_zero(p_ds_buffer->handle_map, map_size, map_size); /* generations stay, so old handles stay stale */
+#endif
+#if DS_TRACK_REQUESTED == 1u
+    ds_zero(p_ds_buffer->allocators.requested, records * sizeof(ds_offset_t), records * sizeof(ds_offset_t));
+#endif
+#if DS_ENGINE == DS_ENGINE_BITMAP
+    const size_t granule_map_size = DS_BIT_WORDS(p_ds_buffer->granule_count) * sizeof(uint32_t);
+    ds_zero(p_ds_buffer->granule_map, granule_map_size, granule_map_size);
+#endif
+    ds_zero(p_ds_buffer->free_classes, sizeof(p_ds_buffer->free_classes), sizeof(p_ds_buffer->free_classes));
+#if DS_ENGINE == DS_ENGINE_TLSF
+    ds_zero(p_ds_buffer->free_sl_map, sizeof(p_ds_buffer->free_sl_map), sizeof(p_ds_buffer->free_sl_map));
+#endif
+    p_ds_buffer->data_head = 0;
+    p_ds_buffer->used_allocators = 0;
+    p_ds_buffer->parked_allocators = 0;
+    p_ds_buffer->tail_record = DS_ALLOC_IDX_NONE;
+    p_ds_buffer->free_class_map = 0;
+    p_ds_buffer->used_bytes = 0;
+#if DS_TRACK_REQUESTED == 1u
+    p_ds_buffer->requested_bytes = 0;
+#endif
+    p_ds_buffer->largest_parked = 0;
+    p_ds_buffer->next_fit_offset = 0;
     return ERROR_DS_OK;
 }
 
@@ -645,11 +4355,27 @@ ds_err_code_t ds_deinit_allocation(dynostatic_buffer_t *p_ds_buffer)
         return ERROR_DS_NO_INIT;
     }
 
+    const size_t storage_size = DS_RECORD_STORAGE_SIZE(p_ds_buffer->record_count, p_ds_buffer->memory_size,
+                                                       (size_t)1u << p_ds_buffer->granule_shift);
+
     p_ds_buffer->init_magic = 0;
-    ds_zero(p_ds_buffer->memory, DS_BUFFER_MEMORY_SIZE, DS_BUFFER_MEMORY_SIZE);
-    ds_zero(p_ds_buffer->allocators, sizeof(p_ds_buffer->allocators), sizeof(p_ds_buffer->allocators));
+    ds_zero(p_ds_buffer->memory, p_ds_buffer->memory_size, p_ds_buffer->memory_size);
+    ds_zero(p_ds_buffer->allocators.head, storage_size, storage_size); /* the record storage starts with head */
+    ds_zero(p_ds_buffer->free_classes, sizeof(p_ds_buffer->free_classes), sizeof(p_ds_buffer->free_classes));
+#if DS_ENGINE == DS_ENGINE_TLSF
+    ds_zero(p_ds_buffer->free_sl_map, sizeof(p_ds_buffer->free_sl_map), sizeof(p_ds_buffer->free_sl_map));
+#endif
     p_ds_buffer->data_head = 0;
     p_ds_buffer->used_allocators = 0;
+    p_ds_buffer->parked_allocators = 0;
+    p_ds_buffer->tail_record = DS_ALLOC_IDX_NONE;
+    p_ds_buffer->free_class_map = 0;
+    p_ds_buffer->used_bytes = 0;
+#if DS_TRACK_REQUESTED == 1u
+    p_ds_buffer->requested_bytes = 0;
+#endif
+    p_ds_buffer->largest_parked = 0;
+    p_ds_buffer->next_fit_offset = 0;
     return ERROR_DS_OK;
 }
 
@@ -670,7 +4396,7 @@ ds_err_code_t ds_safe_memory_copy(const dynostatic_buffer_t *p_alloc_holder, voi
         return ret;
     }
 
-    const size_t capacity = p_alloc_holder->allocators[alloc_idx].size;
+    const size_t capacity = p_alloc_holder->allocators.size[alloc_idx];
     if ((src_size > capacity) || (shift > (capacity - src_size))) {
         return ERROR_DS_NO_MEMORY; /* or a dedicated OUT_OF_BOUNDS — see review */
     }
@@ -696,7 +4422,7 @@ ds_err_code_t ds_safe_memory_set(const dynostatic_buffer_t *p_alloc_holder, void
         return ret;
     }
 
-    const size_t capacity = p_alloc_holder->allocators[alloc_idx].size;
+    const size_t capacity = p_alloc_holder->allocators.size[alloc_idx];
     if ((cnt_to_set > capacity) || (shift > (capacity - cnt_to_set))) {
         return ERROR_DS_NO_MEMORY; /* or a dedicated OUT_OF_BOUNDS — see review */
     }
@@ -34,6 +34,8 @@ extern "C" {
 #define ERROR_DS_CRITICAL_ERR        ((ds_err_code_t)(0x08u)) /**< Critical error detected. */
 #define ERROR_DS_ALLOCATOR_NOT_FOUND ((ds_err_code_t)(0x09u)) /**< Allocator for given pointer is not found. */
 #define ERROR_DS_PTR_ALLOC_YET       ((ds_err_code_t)(0x0Au)) /**< Pointer is already allocated. */
+#define ERROR_DS_STALE_HANDLE        ((ds_err_code_t)(0x0Bu)) /**< Handle does not name a live handle allocation. */
+#define ERROR_DS_HANDLE_LOCKED       ((ds_err_code_t)(0x0Cu)) /**< Handle is locked: it cannot be released or locked further. */
 
 /**@}*/
 
@@ -49,6 +51,23 @@ extern "C" {
     #define DS_ZERO_ON_FREE 0u /**< Zero the contents of freed blocks in dynostatic-buffer. */
 #endif
 
+#ifndef DS_COALESCE_ON_FREE        /**< If You not use CMake and KConfig. */
+    #define DS_COALESCE_ON_FREE 1u /**< Merge a freed block with parked neighbours in dynostatic-buffer. */
+#endif
+
+#define DS_ENGINE_SEGREGATED 0u /**< Bump allocation with reuse from one free list per power-of-two size class. */
+#define DS_ENGINE_TLSF 1u       /**< Two-level segregated fit: constant-time malloc and free. */
+#define DS_ENGINE_BUDDY 2u      /**< Binary buddy system: power-of-two blocks, O(log n) split and merge. */
+#define DS_ENGINE_BITMAP 3u     /**< One bit per granule: first-fit search for a run of free granules. */
+
+#ifndef DS_ENGINE                            /**< If You not use CMake and KConfig. */
+    #define DS_ENGINE DS_ENGINE_SEGREGATED /**< Allocation engine behind the ds_* API (DS_ENGINE_*). */
+#endif
+
+#ifndef DS_TLSF_SL_BITS        /**< If You not use CMake and KConfig. */
+    #define DS_TLSF_SL_BITS 2u /**< log2 of the second-level lists per size class of DS_ENGINE_TLSF. */
+#endif
+
 #ifndef DS_MAX_ALLOCATION_COUNT         /**< If You not use CMake and KConfig. */
     #define DS_MAX_ALLOCATION_COUNT 10u /**< Set maximal number of allocation which can be made in dynostatic-buffer. */
 #endif
@@ -61,6 +80,124 @@ extern "C" {
     #define DS_ALIGNMENT (4u) /**< Alignment for memory allocations. */
 #endif
 
+#ifndef DS_BUDDY_CHUNK_SIZE                               /**< If You not use CMake and KConfig. */
+    #define DS_BUDDY_CHUNK_SIZE DS_MAX_ALLOCATION_SIZE /**< Largest block of DS_ENGINE_BUDDY: untouched space is carved in chunks of it. */
+#endif
+
+#ifndef DS_FIT_POLICY                    /**< If You not use CMake and KConfig. */
+    #define DS_FIT_POLICY DS_FIT_SEGREGATED /**< Placement policy a new instance starts with (see ds_fit_policy_t). */
+#endif
+
+#ifndef DS_CACHE_LINE_SIZE
+    #define DS_CACHE_LINE_SIZE (64u) /**< Cache line size the hot dynostatic_buffer_t header is aligned to. */
+#endif
+
+#ifndef DS_OWNER_MAP        /**< If You not use CMake and KConfig. */
+    #define DS_OWNER_MAP 0u /**< Keep a per-granule owner table for constant-time pointer lookup. */
+#endif
+
+#ifndef DS_HANDLES        /**< If You not use CMake and KConfig. */
+    #define DS_HANDLES 0u /**< Build the movable handle API (ds_halloc(), ds_compact_step()). */
+#endif
+
+#ifndef DS_GROUPS        /**< If You not use CMake and KConfig. */
+    #define DS_GROUPS 0u /**< Build allocation groups (ds_group_malloc(), ds_group_free_all()). */
+#endif
+
+#ifndef DS_TRACK_REQUESTED        /**< If You not use CMake and KConfig. */
+    #define DS_TRACK_REQUESTED 0u /**< Record each block's requested size next to its capacity. */
+#endif
+
+#ifndef DS_EMBEDDED_STORAGE        /**< If You not use CMake and KConfig. */
+    #define DS_EMBEDDED_STORAGE 1u /**< Embed a DS_BUFFER_MEMORY_SIZE arena and its records in dynostatic_buffer_t. */
+#endif
+
+#ifndef DS_MAX_ARENA_SIZE                           /**< If You not use CMake and KConfig. */
+    #define DS_MAX_ARENA_SIZE DS_BUFFER_MEMORY_SIZE /**< Largest arena any instance may have; sizes ds_offset_t. */
+#endif
+
+#ifndef DS_MAX_RECORD_COUNT                            /**< If You not use CMake and KConfig. */
+    #define DS_MAX_RECORD_COUNT DS_MAX_ALLOCATION_COUNT /**< Most records any instance may have; sizes ds_alloc_idx_t. */
+#endif
+
+/** @brief Alignment ds_initialize_allocation_ex() requires of record storage. */
+#define DS_RECORD_STORAGE_ALIGN (8u)
+
+/** @cond DOXYGEN_SHOULD_SKIP_THIS */
+#define DS_STORAGE_ROUND(bytes) ((((size_t)(bytes)) + (DS_RECORD_STORAGE_ALIGN - 1u)) & ~((size_t)DS_RECORD_STORAGE_ALIGN - 1u))
+#define DS_BIT_WORDS(bits)      ((((size_t)(bits)) + 31u) / 32u)
+
+#if DS_HANDLES == 1u
+    #define DS_HANDLE_STORAGE(records)                                                                 \
+        (DS_STORAGE_ROUND((size_t)(records) * sizeof(uint16_t)) + DS_STORAGE_ROUND(records) \
+         + DS_STORAGE_ROUND(DS_BIT_WORDS(records) * sizeof(uint32_t)))
+#else
+    #define DS_HANDLE_STORAGE(records) ((size_t)0u)
+#endif
+#if DS_GROUPS == 1u
+    #define DS_GROUP_STORAGE(records) DS_STORAGE_ROUND((size_t)(records) * sizeof(uint16_t))
+#else
+    #define DS_GROUP_STORAGE(records) ((size_t)0u)
+#endif
+#if DS_TRACK_REQUESTED == 1u
+    #define DS_REQUESTED_STORAGE(records) DS_STORAGE_ROUND((size_t)(records) * sizeof(ds_offset_t))
+#else
+    #define DS_REQUESTED_STORAGE(records) ((size_t)0u)
+#endif
+#if DS_OWNER_MAP == 1u
+    #define DS_OWNER_STORAGE(granules) DS_STORAGE_ROUND((size_t)(granules) * sizeof(ds_alloc_idx_t))
+#else
+    #define DS_OWNER_STORAGE(granules) ((size_t)0u)
+#endif
+#if DS_ENGINE == DS_ENGINE_BITMAP
+    #define DS_GRANULE_STORAGE(granules) DS_STORAGE_ROUND(DS_BIT_WORDS(granules) * sizeof(uint32_t))
+#else
+    #define DS_GRANULE_STORAGE(granules) ((size_t)0u)
+#endif
+/** @endcond */
+
+/**
+ * @brief Bytes of record storage an instance needs: the ds_allocator_t
+ *        arrays and per-record bitmaps for @p records records, plus the
+ *        per-granule tables of an arena of @p memory_size bytes carved into
+ *        @p alignment-byte granules. Each array starts on a
+ *        DS_RECORD_STORAGE_ALIGN boundary. A constant expression when the
+ *        arguments are, so it can size a static array.
+ *
+ * An unaligned arena tail is never handed out (see
+ * ds_get_max_new_allocation_size()), so the granule count rounds down.
+ */
+#define DS_RECORD_STORAGE_SIZE(records, memory_size, alignment)                                             \
+    ((2u * DS_STORAGE_ROUND((size_t)(records) * sizeof(ds_offset_t))) + DS_STORAGE_ROUND(records)            \
+     + (4u * DS_STORAGE_ROUND((size_t)(records) * sizeof(ds_alloc_idx_t)))                                   \
+     + (2u * DS_STORAGE_ROUND(DS_BIT_WORDS(records) * sizeof(uint32_t))) + DS_HANDLE_STORAGE(records)        \
+     + DS_GROUP_STORAGE(records) + DS_REQUESTED_STORAGE(records)                                             \
+     + DS_OWNER_STORAGE((size_t)(memory_size) / (size_t)(alignment))                                         \
+     + DS_GRANULE_STORAGE((size_t)(memory_size) / (size_t)(alignment)))
+
+/**
+ * @brief Number of size classes indexing parked DS_FREE blocks.
+ *
+ * Class k holds capacities of [2^k, 2^(k+1)) granules (DS_ALIGNMENT bytes
+ * each), so 32 classes cover any arena addressable with 32-bit granule
+ * counts; occupancy is tracked in a uint32_t bitmask.
+ */
+#define DS_SIZE_CLASS_COUNT (32u)
+
+/**
+ * @brief Number of second-level lists each size class is split into:
+ *        linear subranges of 2^k / DS_TLSF_SL_COUNT granules under
+ *        DS_ENGINE_TLSF, a single list otherwise.
+ */
+#if DS_ENGINE == DS_ENGINE_TLSF
+    #define DS_TLSF_SL_COUNT (1u << DS_TLSF_SL_BITS)
+#else
+    #define DS_TLSF_SL_COUNT (1u)
+#endif
+
+/** @brief Number of free lists indexing parked DS_FREE blocks. */
+#define DS_FREE_LIST_COUNT (DS_SIZE_CLASS_COUNT * DS_TLSF_SL_COUNT)
+
 #ifdef __cplusplus
     #define DS_STATIC_ASSERT(cond, msg) static_assert(cond, msg)
 #else
@@ -87,39 +224,124 @@ DS_STATIC_ASSERT((DS_MAX_ALLOCATION_SIZE % DS_ALIGNMENT) == 0u, "DS_MAX_ALLOCATI
 /* Overflow guard for ds_align_up (discussed at #7 — closes the implicit
      * size + (DS_ALIGNMENT - 1) wraparound relationship for free): */
 DS_STATIC_ASSERT(DS_MAX_ALLOCATION_SIZE <= (SIZE_MAX - DS_ALIGNMENT) + 1u, "ds_align_up may overflow for sizes near SIZE_MAX");
+DS_STATIC_ASSERT((DS_OWNER_MAP == 0u) || (DS_OWNER_MAP == 1u), "DS_OWNER_MAP must be 0 or 1");
+DS_STATIC_ASSERT((DS_COALESCE_ON_FREE == 0u) || (DS_COALESCE_ON_FREE == 1u), "DS_COALESCE_ON_FREE must be 0 or 1");
+DS_STATIC_ASSERT((DS_HANDLES == 0u) || (DS_HANDLES == 1u), "DS_HANDLES must be 0 or 1");
+DS_STATIC_ASSERT((DS_HANDLES == 0u) || (DS_MAX_RECORD_COUNT <= 0xFFFFu), "DS_HANDLES keeps the record index in the low 16 bits of a handle");
+DS_STATIC_ASSERT((DS_GROUPS == 0u) || (DS_GROUPS == 1u), "DS_GROUPS must be 0 or 1");
+DS_STATIC_ASSERT((DS_GROUPS == 0u) || (DS_MAX_RECORD_COUNT < 0xFFFFu), "DS_GROUPS needs a 16-bit group tag no live block carries");
+DS_STATIC_ASSERT((DS_TRACK_REQUESTED == 0u) || (DS_TRACK_REQUESTED == 1u), "DS_TRACK_REQUESTED must be 0 or 1");
+DS_STATIC_ASSERT((DS_EMBEDDED_STORAGE == 0u) || (DS_EMBEDDED_STORAGE == 1u), "DS_EMBEDDED_STORAGE must be 0 or 1");
+DS_STATIC_ASSERT(DS_BUFFER_MEMORY_SIZE <= DS_MAX_ARENA_SIZE, "DS_MAX_ARENA_SIZE must hold DS_BUFFER_MEMORY_SIZE");
+DS_STATIC_ASSERT(DS_MAX_ALLOCATION_COUNT <= DS_MAX_RECORD_COUNT, "DS_MAX_RECORD_COUNT must hold DS_MAX_ALLOCATION_COUNT");
+DS_STATIC_ASSERT((DS_ENGINE == DS_ENGINE_SEGREGATED) || (DS_ENGINE == DS_ENGINE_TLSF) || (DS_ENGINE == DS_ENGINE_BUDDY)
+                     || (DS_ENGINE == DS_ENGINE_BITMAP),
+                 "DS_ENGINE must name a DS_ENGINE_* value");
+DS_STATIC_ASSERT((DS_ENGINE != DS_ENGINE_TLSF) || ((DS_OWNER_MAP == 1u) && (DS_COALESCE_ON_FREE == 1u)),
+                 "DS_ENGINE_TLSF needs DS_OWNER_MAP and DS_COALESCE_ON_FREE for its constant-time bounds");
+DS_STATIC_ASSERT((DS_ENGINE != DS_ENGINE_BUDDY) || ((DS_OWNER_MAP == 1u) && (DS_COALESCE_ON_FREE == 1u)),
+                 "DS_ENGINE_BUDDY needs DS_OWNER_MAP to find buddies and DS_COALESCE_ON_FREE to merge them");
+DS_STATIC_ASSERT((DS_ENGINE != DS_ENGINE_BITMAP) || (DS_OWNER_MAP == 1u),
+                 "DS_ENGINE_BITMAP needs DS_OWNER_MAP to find the record of a pointer");
+DS_STATIC_ASSERT((DS_ENGINE != DS_ENGINE_BUDDY)
+                     || ((((DS_BUDDY_CHUNK_SIZE / DS_ALIGNMENT) & ((DS_BUDDY_CHUNK_SIZE / DS_ALIGNMENT) - 1u)) == 0u)
+                         && ((DS_BUDDY_CHUNK_SIZE % DS_ALIGNMENT) == 0u)),
+                 "DS_BUDDY_CHUNK_SIZE must be DS_ALIGNMENT times a power of two");
+DS_STATIC_ASSERT((DS_ENGINE != DS_ENGINE_BUDDY)
+                     || ((DS_BUDDY_CHUNK_SIZE >= DS_MAX_ALLOCATION_SIZE) && (DS_BUDDY_CHUNK_SIZE <= DS_BUFFER_MEMORY_SIZE)),
+                 "DS_BUDDY_CHUNK_SIZE must hold DS_MAX_ALLOCATION_SIZE and fit the buffer");
+DS_STATIC_ASSERT((DS_TLSF_SL_BITS >= 1u) && (DS_TLSF_SL_BITS <= 5u), "DS_TLSF_SL_BITS must be in [1, 5] (32-bit second-level bitmaps)");
+DS_STATIC_ASSERT((DS_CACHE_LINE_SIZE & (DS_CACHE_LINE_SIZE - 1u)) == 0u, "DS_CACHE_LINE_SIZE must be a power of two");
+DS_STATIC_ASSERT((DS_MAX_ARENA_SIZE / DS_ALIGNMENT) <= UINT32_MAX, "granule counts must fit the 32-bit size-class bitmask");
 /** @endcond */
 
 /*---------------Types----------------*/
 
 typedef uint16_t ds_err_code_t; /**< Type of error code used in dynostatic-buffer. */
 
+/**
+ * @typedef ds_alloc_idx_t
+ * @brief Smallest unsigned type able to hold any allocator record index
+ *        (0..DS_MAX_RECORD_COUNT - 1) plus the DS_ALLOC_IDX_NONE
+ *        sentinel. Used by side tables and record links, where a size_t per
+ *        entry would dwarf the data it describes.
+ */
+#if DS_MAX_RECORD_COUNT < 0xFFu
+typedef uint8_t ds_alloc_idx_t;
+#elif DS_MAX_RECORD_COUNT < 0xFFFFu
+typedef uint16_t ds_alloc_idx_t;
+#else
+typedef uint32_t ds_alloc_idx_t;
+#endif
+
+#define DS_ALLOC_IDX_NONE ((ds_alloc_idx_t)~(ds_alloc_idx_t)0u) /**< "No record": terminates record links. */
+
+#if DS_HANDLES == 1u
+/**
+ * @typedef ds_handle_t
+ * @brief Name of a movable block returned by ds_halloc(): the index of its
+ *        record in the low 16 bits and the record's generation in the high
+ *        16 bits. Generations start at 1, so no valid handle is 0.
+ */
+typedef uint32_t ds_handle_t;
+
+    #define DS_HANDLE_NONE ((ds_handle_t)0u) /**< "No handle": never returned by ds_halloc(). */
+#endif
+
+/**
+ * @typedef ds_offset_t
+ * @brief Smallest unsigned type able to hold any byte offset or capacity
+ *        inside any arena (0..DS_MAX_ARENA_SIZE). Record heads and sizes
+ *        are stored in it, so a 1 KiB arena pays 2 bytes per field instead
+ *        of sizeof(size_t).
+ */
+#if DS_MAX_ARENA_SIZE <= 0xFFFFu
+typedef uint16_t ds_offset_t;
+#elif DS_MAX_ARENA_SIZE <= 0xFFFFFFFFu
+typedef uint32_t ds_offset_t;
+#else
+typedef size_t ds_offset_t;
+#endif
+
+/**
+ * @typedef ds_mark_t
+ * @brief Checkpoint returned by ds_get_mark(): the arena offset below which
+ *        every block live at that moment lies.
+ */
+typedef size_t ds_mark_t;
+
 /**
  * @enum ds_allocator_status_t
  * @brief Lifecycle state of an allocator record (see ds_allocator_t for the
  *        full lifecycle diagram and the invariants tied to these states).
  *
- * @note CONTRACT: DS_NOT_USED must remain 0. ds_initialize_allocation()
- *       establishes the all-records-DS_NOT_USED state by zeroing the
- *       allocators array (ds_zero), and the compact-prefix invariant
- *       assumes a zeroed record reads as DS_NOT_USED. Renumbering this
- *       enum silently breaks initialization.
+ * @note CONTRACT: DS_NOT_USED must remain 0 and every value must fit in
+ *       a byte (records store the state as uint8_t).
+ *       ds_initialize_allocation() establishes the all-records-DS_NOT_USED
+ *       state by zeroing the record table (ds_zero), which assumes a
+ *       zeroed record reads as DS_NOT_USED. Renumbering this enum silently
+ *       breaks initialization.
  */
 typedef enum {
     DS_NOT_USED = 0x00, /**< Record carries no block: either never used, or
                              reclaimed by bump-head rollback/cascade. head and
-                             size are zero and meaningless. Scans may stop at
-                             the first DS_NOT_USED record (compact prefix).
+                             size are zero and meaningless, and the record is
+                             not on the physical chain.
                              Entered from: initialization, rollback of a
                              trailing block. Leaves to: DS_ALLOCATED via a
-                             fresh bump allocation. */
+                             fresh bump allocation, or DS_FREE when it is
+                             recruited for the remainder of a split. */
     DS_FREE = 0x01,     /**< Block was freed but its record is parked for
                              reuse: head and size (physical capacity) remain
                              valid, and contents are zeroed when
-                             DS_ZERO_ON_FREE is enabled. A later request of
-                             size <= capacity may reuse this exact block.
+                             DS_ZERO_ON_FREE is enabled. The record is linked
+                             into the free list of its size class. A later
+                             request of size <= capacity may reuse this
+                             block, splitting off any surplus.
                              Entered from: DS_ALLOCATED via ds_free of a
-                             non-trailing block. Leaves to: DS_ALLOCATED via
-                             reuse, or DS_NOT_USED via the reclamation
+                             non-trailing block, or DS_NOT_USED as the
+                             remainder of a split. Leaves to: DS_ALLOCATED
+                             via reuse, or DS_NOT_USED via the reclamation
                              cascade. */
     DS_ALLOCATED = 0x02 /**< Block is live and owned by the caller: head and
                              size (physical capacity, >= the requested size)
@@ -130,9 +352,63 @@ typedef enum {
                              the block is trailing. */
 } ds_allocator_status_t;
 
+/**
+ * @enum ds_fit_policy_t
+ * @brief How a request chooses among the parked DS_FREE blocks that can hold
+ *        it. Set per instance with ds_set_fit_policy(); new instances start
+ *        with DS_FIT_POLICY.
+ *
+ * Every policy finds a fitting parked block whenever one exists, so
+ * ds_get_max_new_allocation_size() is exact under all of them. Bump
+ * allocation from data_head is the fallback in every case. Complexities are
+ * in parked blocks P and records R.
+ *
+ * DS_ENGINE_TLSF always places with its own constant-time good fit (see
+ * ds_malloc()); there DS_FIT_FIRST, DS_FIT_BEST and DS_FIT_NEXT select that
+ * same placement, and DS_FIT_ROUNDED only adds its capacity rounding.
+ * DS_ENGINE_BUDDY ignores the policy altogether: capacities are powers of
+ * two and the smallest free order that fits is split. So does
+ * DS_ENGINE_BITMAP, which always takes the lowest-addressed free run.
+ */
+typedef enum {
+    DS_FIT_SEGREGATED = 0x00, /**< Good fit over the size-class free lists: the
+                                   head of the lowest class whose blocks all fit,
+                                   else a walk of the request's own class.
+                                   O(1) when a larger class is non-empty,
+                                   O(P) worst case. */
+    DS_FIT_FIRST = 0x01,      /**< Lowest-addressed fitting block. Keeps the
+                                   low arena dense and leaves the high end to
+                                   the bump head. O(R / 32 + P). */
+    DS_FIT_BEST = 0x02,       /**< Smallest fitting block. Minimizes the
+                                   surplus split off. Walks the request's own
+                                   class and the lowest larger non-empty
+                                   class: O(P) worst case. */
+    DS_FIT_NEXT = 0x03,       /**< First fit resuming from the end of the
+                                   previous placement (a roving offset),
+                                   wrapping to the arena start. Spreads reuse
+                                   over the arena. O(R / 32 + P). */
+    DS_FIT_ROUNDED = 0x04     /**< DS_FIT_SEGREGATED with capacities rounded
+                                   up to a size grid of four steps per power of
+                                   two granules (at most 25 % extra per block).
+                                   A freed block then exactly matches later
+                                   requests of its grid step, so reuse needs no
+                                   split and leaves no slivers. Same complexity
+                                   as DS_FIT_SEGREGATED. */
+} ds_fit_policy_t;
+
+/** @cond DOXYGEN_SHOULD_SKIP_THIS */
+DS_STATIC_ASSERT((DS_FIT_POLICY >= DS_FIT_SEGREGATED) && (DS_FIT_POLICY <= DS_FIT_ROUNDED), "DS_FIT_POLICY must name a ds_fit_policy_t value");
+/** @endcond */
+
 /**
  * @struct ds_allocator_t
- * @brief Bookkeeping record describing one memory block within the buffer.
+ * @brief Table of bookkeeping records, one per memory block within the
+ *        buffer, stored as a structure of arrays: record i is the i-th
+ *        element of every array. Scans that only need one field (sizes for
+ *        usage, heads for lookup) touch a dense array of ds_offset_t instead
+ *        of striding over whole records. The arrays hold
+ *        dynostatic_buffer_t::record_count elements each and live in the
+ *        instance's record storage (see DS_RECORD_STORAGE_SIZE).
  *
  * Lifecycle of a record:
  * @verbatim
@@ -143,103 +419,397 @@ typedef enum {
  * A record returns to DS_NOT_USED only when the bump head is rolled back
  * over it (trailing-block reclamation); an ordinary free parks it as DS_FREE
  * so the block can be reused by a later allocation of equal or smaller size.
+ * Reuse trims the block to the request and parks the surplus in a spare
+ * DS_NOT_USED record, which enters as DS_FREE.
  *
- * Field semantics depend on allocation_status:
+ * Field semantics of record i depend on allocation_status[i]:
  * - DS_NOT_USED: head and size are zero and carry no meaning (slot never
  *   used, or reclaimed by rollback).
  * - DS_ALLOCATED / DS_FREE: head is the block's offset from the start of
  *   dynostatic_buffer_t::memory; size is the block's PHYSICAL CAPACITY —
- *   the requested size rounded up to DS_ALIGNMENT. Reusing a block with a
- *   smaller request does NOT shrink size: capacity is retained for the
- *   lifetime of the record.
- *
- * Invariants maintained by ds_malloc/ds_free — allocator scans, the early
- * break on DS_NOT_USED, and the reclamation cascade all rely on them:
- * 1. Compact prefix: every record past the first DS_NOT_USED slot is also
- *    DS_NOT_USED, so scans may legally stop at the first DS_NOT_USED entry.
- * 2. Ordering: among non-DS_NOT_USED records, array index order equals head
- *    order (heads strictly increase with index).
- * 3. Gapless partition: non-DS_NOT_USED records tile [0, data_head) exactly:
- *    head[0] == 0 and head[i+1] == head[i] + size[i]. In particular the
- *    block ending at data_head always sits at the highest touched index.
+ *   the requested size rounded up to the instance's alignment (a granule,
+ *   DS_ALIGNMENT unless ds_initialize_allocation_ex() chose another).
+ *   Reusing a block with a smaller request splits it down to the aligned
+ *   request when a spare record is available, and otherwise retains the
+ *   whole capacity.
+ *
+ * Invariants maintained by ds_malloc/ds_free — lookups, reuse and the
+ * reclamation cascade all rely on them:
+ * 1. Physical chain: the non-DS_NOT_USED records are linked through
+ *    prev_phys/next_phys in address order. The chain tiles [0, data_head)
+ *    exactly: its first block has head 0, head[next_phys[i]] == head[i] +
+ *    size[i], and dynostatic_buffer_t::tail_record names the block ending
+ *    at data_head. Records are recruited at any DS_NOT_USED index, so
+ *    array order carries no meaning.
+ * 2. The tail is never DS_FREE: freeing the tail reclaims it instead.
+ *    With DS_COALESCE_ON_FREE enabled no two DS_FREE blocks are physical
+ *    neighbours either; without it, ds_coalesce() restores that.
+ *    DS_ENGINE_BUDDY relaxes both: see invariant 5.
+ * 3. Segregated free lists: every DS_FREE record, and no other, is linked
+ *    into exactly one doubly linked list — that of its size class
+ *    (floor(log2(size / granule))) — and bit k of
+ *    dynostatic_buffer_t::free_class_map is set iff class k holds any.
+ *    Under DS_ENGINE_TLSF each class is further split into
+ *    DS_TLSF_SL_COUNT lists of equal granule ranges, tracked by
+ *    dynostatic_buffer_t::free_sl_map.
+ * 4. State bitmaps: bit i of dynostatic_buffer_t::allocated_map is set iff
+ *    record i is DS_ALLOCATED, and bit i of parked_map iff it is DS_FREE.
+ *    Record scans walk these words with a bit scan instead of reading
+ *    every record.
+ * 5. Buddy blocks (DS_ENGINE_BUDDY only): every size is a granule times
+ *    a power of two, so size class k is order k and all blocks of a free
+ *    list have one size; every head is a multiple of its size. Untouched
+ *    space is handed out in chunks of at most
+ *    dynostatic_buffer_t::buddy_chunk_size, and a
+ *    block's buddy is the one at head ^ size inside the same chunk. Two
+ *    free buddies are always merged, but a DS_FREE block may neighbour
+ *    another DS_FREE block that is not its buddy, and may be the tail; only
+ *    a whole free chunk at the tail is reclaimed.
+ * 6. Granule bitmap (DS_ENGINE_BITMAP only): records are never DS_FREE.
+ *    Free space is the clear bits of dynostatic_buffer_t::granule_map, so
+ *    it needs no record and neighbouring free runs are merged by
+ *    construction. Invariants 1-3 are void: the physical chain and the free
+ *    lists stay empty, tail_record stays DS_ALLOC_IDX_NONE, and data_head
+ *    is one past the highest granule of a live block.
+ * 7. Handle blocks (DS_HANDLES only): bit i of
+ *    dynostatic_buffer_t::handle_map is set only while record i is
+ *    DS_ALLOCATED by ds_halloc(). Such a block is released by ds_hfree()
+ *    alone; ds_compact_step() may change its head while lock_count[i] is 0,
+ *    but never its record, so a handle stays valid across moves.
  */
 typedef struct {
-    size_t head; /**< Offset of the block from the start of dynostatic_buffer_t::memory.
-                      Meaningful only when allocation_status != DS_NOT_USED. */
-    size_t size; /**< Physical capacity of the block (requested size aligned up to
-                      DS_ALIGNMENT); preserved on reuse. Meaningful only when
-                      allocation_status != DS_NOT_USED. */
-
-    ds_allocator_status_t allocation_status; /**< Lifecycle state of this record; governs
-                                                  the meaning of head and size. */
+    ds_offset_t *head; /**< Offset of each block from the start of
+                            dynostatic_buffer_t::memory. Meaningful
+                            only when allocation_status != DS_NOT_USED. */
+    ds_offset_t *size; /**< Physical capacity of each block (requested
+                            size aligned up to a granule); preserved on
+                            reuse. Meaningful only when
+                            allocation_status != DS_NOT_USED. */
+
+    uint8_t *allocation_status; /**< Lifecycle state of each record (a
+                                     ds_allocator_status_t value);
+                                     governs the meaning of head and
+                                     size. */
+
+    ds_alloc_idx_t *prev_free; /**< Previous record in the size-class
+                                    free list, or DS_ALLOC_IDX_NONE.
+                                    Meaningful only when DS_FREE. */
+    ds_alloc_idx_t *next_free; /**< Next record in the size-class free
+                                    list, or DS_ALLOC_IDX_NONE.
+                                    Meaningful only when DS_FREE. */
+
+    ds_alloc_idx_t *prev_phys; /**< Record of the block physically
+                                    preceding this one, or
+                                    DS_ALLOC_IDX_NONE at offset 0.
+                                    Meaningful only when
+                                    allocation_status != DS_NOT_USED. */
+    ds_alloc_idx_t *next_phys; /**< Record of the block physically
+                                    following this one, or
+                                    DS_ALLOC_IDX_NONE for the tail.
+                                    Meaningful only when
+                                    allocation_status != DS_NOT_USED. */
+#if DS_HANDLES == 1u
+    uint16_t *generation; /**< Advanced each time ds_halloc() takes the
+                               record (skipping 0); a handle is valid
+                               only while it carries the current
+                               value. */
+    uint8_t *lock_count;  /**< Outstanding ds_hlock() calls on a handle
+                               block; it moves only while 0.
+                               Meaningful only when the record's
+                               handle_map bit is set. */
+#endif
+#if DS_GROUPS == 1u
+    uint16_t *group; /**< Tag of the ds_group_t the block was allocated
+                          through, or 0. Cleared whenever the record
+                          becomes DS_ALLOCATED and carried along by a
+                          moving ds_realloc(). Meaningful only when
+                          allocation_status == DS_ALLOCATED. */
+#endif
+#if DS_TRACK_REQUESTED == 1u
+    ds_offset_t *requested; /**< Bytes last asked for the block, at most its
+                                 capacity: the size given to the allocating
+                                 or resizing call. 0 whenever the record is
+                                 not DS_ALLOCATED. */
+#endif
 } ds_allocator_t;
 
+/**
+ * @struct ds_config_t
+ * @brief Storage and limits of an instance set up by
+ *        ds_initialize_allocation_ex().
+ *
+ * The instance keeps pointers into both regions until
+ * ds_deinit_allocation(); the caller owns them and must keep them alive and
+ * untouched meanwhile. They must not overlap each other or the
+ * dynostatic_buffer_t itself.
+ */
+typedef struct {
+    void *p_memory;             /**< The arena: every block is carved from it. Aligned to
+                                     alignment. */
+    size_t memory_size;         /**< Bytes at p_memory (alignment..DS_MAX_ARENA_SIZE). A tail
+                                     past the last whole granule is never handed out. */
+    void *p_records;            /**< Record storage, aligned to DS_RECORD_STORAGE_ALIGN. */
+    size_t records_size;        /**< Bytes at p_records: at least
+                                     DS_RECORD_STORAGE_SIZE(record_count, memory_size,
+                                     alignment). */
+    size_t record_count;        /**< Records, and so the most blocks live and parked at once
+                                     (1..DS_MAX_RECORD_COUNT). */
+    size_t alignment;           /**< Alignment, and granule, of every block: a power of two
+                                     no smaller than DS_ALIGNMENT. */
+    size_t max_allocation_size; /**< Largest single request: a positive multiple of
+                                     alignment, at most memory_size. Under DS_ENGINE_BUDDY it
+                                     rounded up to alignment times a power of two is the
+                                     chunk size, which must fit memory_size as well. */
+} ds_config_t;
+
 /**
  * @struct dynostatic_buffer_t
  * @brief Self-contained allocator instance emulating dynamic allocation
- *        inside a caller-provided static buffer — no heap, no globals.
+ *        inside a static buffer — no heap, no globals.
+ *
+ * An instance is a fixed header over two regions: the arena blocks are
+ * carved from and the record storage describing them. With
+ * DS_EMBEDDED_STORAGE enabled (default) both are embedded here, sized by
+ * DS_BUFFER_MEMORY_SIZE and DS_MAX_ALLOCATION_COUNT, and
+ * ds_initialize_allocation() attaches them; the structure can then be
+ * placed in static storage (recommended), on a stack, or inside another
+ * object. Note the footprint: roughly DS_BUFFER_MEMORY_SIZE +
+ * DS_RECORD_STORAGE_SIZE(DS_MAX_ALLOCATION_COUNT, DS_BUFFER_MEMORY_SIZE,
+ * DS_ALIGNMENT) bytes (about 2 * sizeof(ds_offset_t) + 1 +
+ * 4 * sizeof(ds_alloc_idx_t) bytes per record, 3 more under DS_HANDLES,
+ * plus sizeof(ds_alloc_idx_t) per granule when DS_OWNER_MAP is enabled and
+ * one bit per granule under DS_ENGINE_BITMAP) — on small targets prefer
+ * static storage duration over the stack. ds_initialize_allocation_ex()
+ * instead runs an instance over caller-provided regions of any size and
+ * record count up to DS_MAX_ARENA_SIZE and DS_MAX_RECORD_COUNT, with its
+ * own alignment and allocation cap; disable DS_EMBEDDED_STORAGE when every
+ * instance is set up that way, and the structure shrinks to its header.
  *
- * All state lives inline in this structure, so an instance can be placed in
- * static storage (recommended), on a stack, or inside another object, and
- * multiple independent instances may coexist. Note the footprint: roughly
- * DS_BUFFER_MEMORY_SIZE + DS_MAX_ALLOCATION_COUNT * sizeof(ds_allocator_t)
- * bytes — on small targets prefer static storage duration over the stack.
+ * The fields every call reads (init_magic, data_head, the record counters,
+ * the class bitmask and the arena base) lead the structure, which is
+ * aligned to DS_CACHE_LINE_SIZE so they share a single cache line.
  *
  * Lifecycle: zero the structure (static storage duration does this for
- * free), then ds_initialize_allocation(), then the allocation API, then
- * ds_deinit_allocation() (zeroes all memory and bookkeeping).
+ * free), then ds_initialize_allocation() or ds_initialize_allocation_ex(),
+ * then the allocation API, then ds_deinit_allocation() (zeroes the arena
+ * and all bookkeeping).
  *
  * @warning Initialization detection relies on init_magic, so the structure
- *          MUST be zero-initialized before the first
- *          ds_initialize_allocation() call. An instance containing garbage
- *          (e.g. a stack variable) may spuriously read as already
- *          initialized. Static storage duration satisfies this requirement
- *          automatically.
+ *          MUST be zero-initialized before the first initialization call.
+ *          An instance containing garbage (e.g. a stack variable) may
+ *          spuriously read as already initialized. Static storage duration
+ *          satisfies this requirement automatically.
+ *
+ * @warning The structure points into its own storage (or the caller's), so
+ *          it must not be copied or moved while initialized.
  *
  * @warning Not thread-safe and not ISR-safe: no internal locking. The
  *          caller must serialize all API calls on a given instance
  *          (distinct instances are fully independent).
  *
  * Pointers returned by the allocation API point into @ref memory and are
- * aligned to DS_ALIGNMENT. They become invalid after ds_free() of the block
- * and after ds_deinit_allocation() of the instance.
+ * aligned to the instance's alignment. They become invalid after ds_free()
+ * of the block and after ds_deinit_allocation() of the instance.
  */
 typedef struct {
-    uint16_t init_magic;    /**< Equals DS_MAGIC_NUMBER while the instance is
-                                 initialized; any other value means
-                                 uninitialized. Requires the structure to be
-                                 zeroed before first init (see warning). */
-    size_t data_head;       /**< Bump pointer: offset of the first byte of
-                                 never-touched (or reclaimed) space in memory.
-                                 Always in [0, DS_BUFFER_MEMORY_SIZE]. Equal to
-                                 the sum of capacities of all non-DS_NOT_USED
-                                 records (gapless-partition invariant, see
-                                 ds_allocator_t). Rolls back when trailing
-                                 blocks are freed. */
-    size_t used_allocators; /**< Number of records currently in DS_ALLOCATED
-                                 state (live blocks owned by callers). Parked
-                                 DS_FREE records are NOT counted. Always in
-                                 [0, DS_MAX_ALLOCATION_COUNT]. */
+    alignas(DS_CACHE_LINE_SIZE)
+        uint16_t init_magic;    /**< Equals DS_MAGIC_NUMBER while the instance is
+                                     initialized; any other value means
+                                     uninitialized. Requires the structure to be
+                                     zeroed before first init (see warning). */
+    uint8_t fit_policy;         /**< Active ds_fit_policy_t of this instance. */
+    uint8_t granule_shift;      /**< log2 of the instance's alignment: blocks are
+                                     carved in granules of 1 << granule_shift
+                                     bytes. */
+    ds_alloc_idx_t tail_record; /**< Record whose block ends at data_head, or
+                                     DS_ALLOC_IDX_NONE while the arena is
+                                     empty. */
+    uint32_t free_class_map;    /**< Bit k set iff size class k has a non-empty
+                                     free list (the per-order bitmap of
+                                     DS_ENGINE_BUDDY). */
+    size_t data_head;           /**< Bump pointer: offset of the first byte of
+                                     never-touched (or reclaimed) space in memory.
+                                     Always in [0, memory_size]. Equal to
+                                     the sum of capacities of all non-DS_NOT_USED
+                                     records (physical-chain invariant, see
+                                     ds_allocator_t). Rolls back when trailing
+                                     blocks are freed. Under DS_ENGINE_BITMAP,
+                                     one past the highest live granule. */
+    size_t used_allocators;     /**< Number of records currently in DS_ALLOCATED
+                                     state (live blocks owned by callers). Parked
+                                     DS_FREE records are NOT counted. Always in
+                                     [0, record_count]. */
+    size_t parked_allocators;   /**< Number of records currently in DS_FREE
+                                     state. A DS_NOT_USED record exists iff
+                                     used_allocators + parked_allocators <
+                                     record_count. */
+    size_t used_bytes;          /**< Sum of the capacities of all DS_ALLOCATED
+                                     records, kept current on every state and
+                                     capacity change. */
+#if DS_TRACK_REQUESTED == 1u
+    size_t requested_bytes;     /**< Sum of the requested sizes of all
+                                     DS_ALLOCATED records; used_bytes minus
+                                     it is the internal fragmentation. */
+#endif
+    uint8_t *memory;            /**< The arena. All user pointers point into it;
+                                     its base (and therefore every aligned
+                                     offset) meets the instance's alignment. */
+
+    size_t memory_size;         /**< Bytes in the arena. */
+    size_t record_count;        /**< Elements in every record array and one bit
+                                     per record in every record bitmap. */
+    size_t granule_count;       /**< Whole granules in the arena: the entries of
+                                     owner_map and the bits of granule_map. */
+    size_t max_allocation_size; /**< Largest single request the instance takes. */
+#if DS_ENGINE == DS_ENGINE_BUDDY
+    size_t buddy_chunk_size;    /**< Largest block of DS_ENGINE_BUDDY: untouched
+                                     space is carved in chunks of it. */
+#endif
+    size_t largest_parked;      /**< Largest capacity among DS_FREE records, or
+                                     0 when none is parked. Maintained only
+                                     under DS_ENGINE_SEGREGATED; the other
+                                     engines answer from their free-list
+                                     bitmaps instead. */
+    size_t next_fit_offset;     /**< Arena offset just past the latest placement;
+                                     where a DS_FIT_NEXT search resumes. */
+#if DS_GROUPS == 1u
+    uint16_t last_group;        /**< Tag handed to the latest ds_group_init();
+                                     the next one searches upwards from it. */
+#endif
+    ds_alloc_idx_t free_classes[DS_FREE_LIST_COUNT]; /**< Head record of each free
+                                                          list (class k, second level
+                                                          j at k * DS_TLSF_SL_COUNT + j);
+                                                          read only when its bitmap
+                                                          bit is set. */
+#if DS_ENGINE == DS_ENGINE_TLSF
+    uint32_t free_sl_map[DS_SIZE_CLASS_COUNT]; /**< Bit j of word k set iff second-level
+                                                    list j of size class k is
+                                                    non-empty. */
+#endif
 
+    ds_allocator_t allocators; /**< Block record table; invariants documented at
+                                    ds_allocator_t. */
+    uint32_t *allocated_map;   /**< Bit i set iff record i is DS_ALLOCATED. */
+    uint32_t *parked_map;      /**< Bit i set iff record i is DS_FREE. */
+#if DS_HANDLES == 1u
+    uint32_t *handle_map;      /**< Bit i set iff record i holds a block
+                                    allocated by ds_halloc(). */
+#endif
+#if DS_ENGINE == DS_ENGINE_BITMAP
+    uint32_t *granule_map;     /**< Bit g % 32 of word g / 32 set iff granule g
+                                    belongs to a DS_ALLOCATED block. Bits
+                                    past granule_count stay clear. */
+#endif
+#if DS_OWNER_MAP == 1u
+    ds_alloc_idx_t *owner_map; /**< Owner of each granule: exact for every
+                                    granule of a DS_ALLOCATED block, and under
+                                    DS_ENGINE_BUDDY for the first granule of a
+                                    DS_FREE one. Other entries may be stale
+                                    and are trusted only after checking the
+                                    named record. Turns pointer-to-record
+                                    lookup into one indexed load. */
+#endif
+
+#if DS_EMBEDDED_STORAGE == 1u
     alignas(DS_ALIGNMENT)
-        uint8_t memory[DS_BUFFER_MEMORY_SIZE];          /**< The arena. All user pointers point
-                                                             into this array; alignas guarantees the
-                                                             base address (and therefore every
-                                                             aligned offset) meets DS_ALIGNMENT. */
-    ds_allocator_t allocators[DS_MAX_ALLOCATION_COUNT]; /**< Block records; invariants documented
-                                                             at ds_allocator_t. Records are
-                                                             recruited in index order (compact
-                                                             prefix). */
+        uint8_t arena[DS_BUFFER_MEMORY_SIZE]; /**< Arena attached by
+                                                   ds_initialize_allocation(). */
+    alignas(DS_RECORD_STORAGE_ALIGN)
+        uint8_t record_storage[DS_RECORD_STORAGE_SIZE(DS_MAX_ALLOCATION_COUNT, DS_BUFFER_MEMORY_SIZE, DS_ALIGNMENT)]; /**< Record
+                                                   storage attached by
+                                                   ds_initialize_allocation(). */
+#endif
 } dynostatic_buffer_t;
 
+/** @cond DOXYGEN_SHOULD_SKIP_THIS */
+DS_STATIC_ASSERT((offsetof(dynostatic_buffer_t, memory) + sizeof(uint8_t *)) <= DS_CACHE_LINE_SIZE,
+                 "hot dynostatic_buffer_t header must fit in one cache line");
+DS_STATIC_ASSERT((alignof(ds_offset_t) <= DS_RECORD_STORAGE_ALIGN) && (alignof(uint32_t) <= DS_RECORD_STORAGE_ALIGN),
+                 "DS_RECORD_STORAGE_ALIGN must align every record array");
+/** @endcond */
+
+/** @brief "No slot": terminates the free list of a ds_pool_t. */
+#define DS_POOL_SLOT_NONE (UINT32_MAX)
+
+/**
+ * @struct ds_pool_t
+ * @brief Fixed-size slots carved from a single ds_malloc() block.
+ *
+ * The whole pool costs one allocator record however many slots it has.
+ * ds_pool_alloc() and ds_pool_free() run in constant time and never touch
+ * the instance's records. Free slots are linked through their first four
+ * bytes by slot index, and slots never handed out since ds_pool_create()
+ * are taken in order from fresh, so creating a pool does not visit them.
+ * A bitmap of one bit per slot, kept in the same block after the last
+ * slot, marks the slots handed out, so every double release is caught.
+ *
+ * @warning Zero the structure before the first ds_pool_create(), as for
+ *          dynostatic_buffer_t.
+ */
+typedef struct {
+    dynostatic_buffer_t *p_ds_buffer; /**< Instance owning the block; NULL while
+                                           the pool is not created. */
+    uint8_t *p_slots;                 /**< The block: slot i starts at
+                                           p_slots + i * slot_size. */
+    size_t slot_size;                 /**< Bytes per slot: the requested size
+                                           rounded up to the instance's
+                                           alignment. */
+    uint32_t *p_in_use;               /**< Bit i set iff slot i is handed out;
+                                           follows the last slot. Bits of
+                                           slots past fresh are
+                                           indeterminate. */
+    uint32_t slot_count;              /**< Slots in the block. */
+    uint32_t fresh;                   /**< Slots [fresh, slot_count) were never
+                                           handed out. */
+    uint32_t free_head;               /**< First released slot, or
+                                           DS_POOL_SLOT_NONE. */
+    uint32_t free_count;              /**< Slots ds_pool_alloc() can still hand
+                                           out: released plus fresh. */
+} ds_pool_t;
+
+/**
+ * @struct ds_multi_desc_t
+ * @brief One sub-object of a block from ds_malloc_multi().
+ */
+typedef struct {
+    size_t size;      /**< Bytes of the sub-object; must not be 0. */
+    size_t alignment; /**< Required alignment: a power of two. For the first
+                           sub-object at most the instance's alignment. */
+} ds_multi_desc_t;
+
+#if DS_GROUPS == 1u
+/**
+ * @struct ds_group_t
+ * @brief Blocks of one instance released together by ds_group_free_all().
+ *
+ * Each block allocated through ds_group_malloc() carries the group's tag in
+ * its record, so members may interleave freely with other blocks and with
+ * other groups' members, and may still be released one by one with
+ * ds_free() or moved by ds_realloc().
+ *
+ * @warning Zero the structure before the first ds_group_init(), as for
+ *          dynostatic_buffer_t.
+ */
+typedef struct {
+    dynostatic_buffer_t *p_ds_buffer; /**< Instance the members come from; NULL
+                                           while the group is not initialized. */
+    uint16_t tag;                     /**< Value stored in the members' records;
+                                           never 0. */
+} ds_group_t;
+#endif
+
 /*-----Public-Function-Declaration----*/
 
+#if DS_EMBEDDED_STORAGE == 1u
 /**
  * @brief Initialize an allocator instance over its embedded arena.
  *
- * Zeroes the arena and all allocator records, resets the bump head, and
- * arms the init_magic marker. After success the full DS_BUFFER_MEMORY_SIZE
- * is allocatable.
+ * A thin wrapper over ds_initialize_allocation_ex(): attaches the embedded
+ * arena and record storage with the compile-time limits DS_BUFFER_MEMORY_SIZE,
+ * DS_MAX_ALLOCATION_COUNT, DS_ALIGNMENT, DS_MAX_ALLOCATION_SIZE and
+ * DS_BUDDY_CHUNK_SIZE. Zeroes the arena and all allocator records, resets
+ * the bump head, and arms the init_magic marker. After success the full
+ * DS_BUFFER_MEMORY_SIZE is allocatable.
  *
  * @pre The structure must be zero-initialized before the FIRST call (see
  *      the warning at dynostatic_buffer_t) — garbage content may spuriously
@@ -253,16 +823,70 @@ typedef struct {
  *                               ds_deinit_allocation() first to reset it.
  */
 ds_err_code_t ds_initialize_allocation(dynostatic_buffer_t *p_ds_buffer);
+#endif
+
+/**
+ * @brief Initialize an allocator instance over caller-provided storage with
+ *        its own limits.
+ *
+ * Every instance of a build shares the engine and the compile-time switches,
+ * but not its sizes: one can run a 4 KiB arena of 16 records, another a
+ * 64 MiB arena of thousands, each backed by whatever memory the caller
+ * chooses (static arrays, pages from the OS, a region of a larger
+ * allocation). The limits apply per instance wherever the rest of this API
+ * names DS_BUFFER_MEMORY_SIZE, DS_MAX_ALLOCATION_COUNT, DS_ALIGNMENT or
+ * DS_MAX_ALLOCATION_SIZE. Size the record storage with
+ * DS_RECORD_STORAGE_SIZE(). The arena and the records are zeroed as by
+ * ds_initialize_allocation(); neither is touched outside the given sizes.
+ *
+ * @pre The structure must be zero-initialized before the FIRST call (see
+ *      the warning at dynostatic_buffer_t).
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] p_config Storage and limits (see ds_config_t); read only
+ *                     during the call.
+ *
+ * @retval ERROR_DS_OK Instance initialized; the whole arena is available.
+ * @retval ERROR_DS_INVALID_ARG p_ds_buffer or p_config is NULL, or the
+ *                              configuration breaks a rule of ds_config_t:
+ *                              a NULL or misaligned region, too little
+ *                              record storage, or a limit out of range.
+ * @retval ERROR_DS_ALREADY_INIT Instance is already initialized; call
+ *                               ds_deinit_allocation() first to reset it.
+ */
+ds_err_code_t ds_initialize_allocation_ex(dynostatic_buffer_t *p_ds_buffer, const ds_config_t *p_config);
 
 /**
  * @brief Allocate a memory block of at least @p size bytes.
  *
- * The returned pointer is aligned to DS_ALIGNMENT and the block's physical
- * capacity is @p size rounded up to DS_ALIGNMENT. The request is served
- * either by reusing a previously freed block of sufficient capacity or by
- * a fresh allocation from untouched space. On success *p_memory receives
+ * The returned pointer is aligned to the instance's alignment and the block's
+ * physical capacity is @p size rounded up to it (or to the size grid under
+ * DS_FIT_ROUNDED). The request is served either by reusing a previously
+ * freed block of sufficient capacity, chosen by the instance's
+ * ds_fit_policy_t, or by a fresh allocation from untouched space. On success *p_memory receives
  * the block address; on any failure *p_memory is left unchanged.
  *
+ * Under DS_ENGINE_TLSF reuse is constant time: the request is rounded up to
+ * the next second-level list boundary and the head of the first non-empty
+ * list at or above it is taken (every block there fits), else the head of
+ * the request's own list if it happens to fit. A parked block whose list
+ * straddles the request, but which is not that list's head, is then passed
+ * over for fresh space even though it would fit.
+ *
+ * Under DS_ENGINE_BUDDY the capacity is @p size rounded up to the alignment
+ * times a power of two. The lowest non-empty order that fits is found with
+ * one bit scan and its head is halved down to the request, each upper half
+ * parked on the free list of its order while a spare record is left to
+ * describe it. Fresh space is carved in chunks of DS_BUDDY_CHUNK_SIZE, or the
+ * cap rounded up the same way for ds_initialize_allocation_ex() (less
+ * at the arena end) and split the same way.
+ *
+ * Under DS_ENGINE_BITMAP the capacity is @p size aligned up to the
+ * alignment, placed at the lowest-addressed run of that many free
+ * granules. The search skips fully used bitmap words eight (AVX2) or four
+ * (SSE4.1) at a time when the target supports it, and tests a whole word
+ * for a short run with a few shifts: O(granules / 32) worst case.
+ *
  * @pre *p_memory must be initialized before the call — NULL or a previously
  *      obtained pointer. The function reads it to reject overwriting a
  *      pointer to a live block (a leak guard); passing an uninitialized
@@ -295,7 +919,13 @@ ds_err_code_t ds_malloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_
  * block is reclaimed immediately (including a cascade through adjacent
  * freed blocks), making the space available to allocations of any size;
  * a freed interior block is parked for reuse by requests fitting its
- * capacity. On success *p_memory is set to NULL.
+ * capacity. With DS_COALESCE_ON_FREE enabled (default) a parked block is
+ * first merged with parked physical neighbours, and the records they used
+ * become spare. Under DS_ENGINE_BUDDY the block is instead merged with its
+ * free buddy, order by order, in O(log n) steps, and only a whole free chunk
+ * at the tail is reclaimed. Under DS_ENGINE_BITMAP the block's granules are
+ * simply cleared and its record becomes spare. On success *p_memory is set
+ * to NULL.
  *
  * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
  * @param[in, out] p_memory In: address of a live block. Out: NULL on success,
@@ -303,7 +933,9 @@ ds_err_code_t ds_malloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_
  *
  * @retval ERROR_DS_OK Block released; *p_memory is now NULL.
  * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
- * @retval ERROR_DS_INVALID_ARG p_ds_buffer, p_memory or *p_memory is NULL.
+ * @retval ERROR_DS_INVALID_ARG p_ds_buffer, p_memory or *p_memory is NULL, or
+ *                              *p_memory is a block of ds_halloc(), which
+ *                              only ds_hfree() releases.
  * @retval ERROR_DS_MEMORY_OUT_OF_DS *p_memory lies outside this instance's
  *                                   arena.
  * @retval ERROR_DS_ALLOCATOR_NOT_FOUND *p_memory is inside the arena but is
@@ -339,6 +971,90 @@ ds_err_code_t ds_free(dynostatic_buffer_t *p_ds_buffer, void **p_memory);
  */
 ds_err_code_t ds_calloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t len, size_t size_of_elem);
 
+/**
+ * @brief Allocate a block of at least @p size bytes whose address is a
+ *        multiple of @p alignment.
+ *
+ * For alignments the instance's own does not cover: cache lines, SIMD
+ * vectors, pages for direct I/O. The returned pointer is the start of the
+ * block, so ds_free(), ds_realloc(), ds_usable_size() and the safe memory
+ * operations take it like any other. An alignment up to the instance's
+ * behaves as ds_malloc(). Above it, the block is placed with room for the
+ * padding and then trimmed:
+ * - DS_ENGINE_SEGREGATED, DS_ENGINE_TLSF: the leading padding is split off
+ *   on a spare record and parked (merged with a parked predecessor under
+ *   DS_COALESCE_ON_FREE), the trailing surplus handed back as by
+ *   ds_commit().
+ * - DS_ENGINE_BITMAP: the padding granules are cleared again.
+ * - DS_ENGINE_BUDDY: no padding; a buddy of at least @p alignment bytes
+ *   lies at a multiple of its size, so it is aligned whenever the arena
+ *   base is. The block is then split down to @p size.
+ *
+ * The block is placed before its address is known, so the worst-case
+ * padding counts against the instance's allocation cap: @p size plus
+ * @p alignment minus the instance's alignment must not exceed it (under
+ * DS_ENGINE_BUDDY, neither @p size nor @p alignment may). Page alignment
+ * for direct I/O is therefore out of reach of the default
+ * DS_MAX_ALLOCATION_SIZE; it needs an instance from
+ * ds_initialize_allocation_ex() whose ds_config_t::max_allocation_size
+ * covers the buffer plus 4096 bytes, less the instance's alignment.
+ *
+ * A ds_realloc() that grows the block in place keeps the alignment; one
+ * that moves it keeps only the instance's.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in, out] p_memory In: must not point to a live block. Out: address
+ *                          of the aligned block.
+ * @param[in] alignment Required alignment: a power of two.
+ * @param[in] size Requested size in bytes; must not be 0.
+ *
+ * @retval ERROR_DS_OK Block allocated; *p_memory is a multiple of alignment.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG NULL arguments, size == 0, alignment not a
+ *                              power of two, or under DS_ENGINE_BUDDY an
+ *                              arena base not aligned to alignment.
+ * @retval ERROR_DS_TOO_BIG_CHUNK size plus the worst-case padding
+ *                                (alignment minus the instance's alignment;
+ *                                under DS_ENGINE_BUDDY the larger of size
+ *                                and alignment) exceeds the instance's
+ *                                allocation cap.
+ * @retval ERROR_DS_PTR_ALLOC_YET *p_memory already points to a live block.
+ * @retval ERROR_DS_NO_ALLOCATORS All allocator records are occupied, or
+ *                                none is left to describe the leading
+ *                                padding.
+ * @retval ERROR_DS_NO_MEMORY No free region can hold the block and its
+ *                            padding.
+ */
+ds_err_code_t ds_aligned_malloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t alignment, size_t size);
+
+/**
+ * @brief Allocate a zero-filled array of @p len elements of @p size_of_elem
+ *        bytes each, aligned to @p alignment.
+ *
+ * ds_calloc() on top of ds_aligned_malloc(): the multiplication is checked
+ * for overflow and the requested bytes are zeroed unconditionally.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in, out] p_memory In: must not point to a live block. Out: address
+ *                          of the zeroed array.
+ * @param[in] alignment Required alignment: a power of two.
+ * @param[in] len Number of elements; must not be 0.
+ * @param[in] size_of_elem Size of one element in bytes; must not be 0.
+ *
+ * @retval ERROR_DS_OK Array allocated and zeroed.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG NULL arguments, zero len/size_of_elem,
+ *                              len * size_of_elem overflows size_t, or an
+ *                              alignment ds_aligned_malloc() rejects.
+ * @retval ERROR_DS_TOO_BIG_CHUNK Total size plus padding exceeds the
+ *                                instance's allocation cap.
+ * @retval ERROR_DS_PTR_ALLOC_YET *p_memory already points to a live block.
+ * @retval ERROR_DS_NO_ALLOCATORS All allocator records are occupied.
+ * @retval ERROR_DS_NO_MEMORY No free region can hold the array and its
+ *                            padding.
+ */
+ds_err_code_t ds_aligned_calloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t alignment, size_t len, size_t size_of_elem);
+
 /**
  * @brief Resize a block, preserving its contents up to the smaller of the
  *        old and new sizes.
@@ -347,14 +1063,20 @@ ds_err_code_t ds_calloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_
  * - size == 0: equivalent to ds_free(p_memory).
  * - *p_memory == NULL: equivalent to ds_malloc(size).
  * - Shrink (new aligned size fits the block's capacity): in place, pointer
- *   unchanged, capacity RETAINED (no split; ds_get_memory_usage() keeps
- *   reporting the original capacity).
+ *   unchanged. The surplus is returned to the arena as reusable space
+ *   (zeroed under DS_ZERO_ON_FREE); only when it can be neither merged
+ *   into a neighbour nor described by a spare record is the capacity
+ *   retained.
  * - Grow of the most recently placed block: extended in place when space
  *   allows — pointer unchanged, no copy.
+ * - Grow of a block followed by parked blocks: extended in place over them
+ *   when they cover the growth — pointer unchanged, no copy. Under
+ *   DS_ENGINE_BITMAP, any block followed by enough free granules.
  * - Grow otherwise: a new block is allocated, contents are copied, the old
  *   block is freed (zeroed under DS_ZERO_ON_FREE). Requires a free
  *   allocator record for the transient old+new pair. Bytes beyond the old
- *   size have indeterminate values.
+ *   size have indeterminate values. Under DS_TRACK_REQUESTED only the old
+ *   requested size is copied, not the block's whole capacity.
  * - A pointer that is not the start of a live block is REJECTED — unlike
  *   C realloc's undefined behaviour, and no new block is allocated.
  *
@@ -369,7 +1091,9 @@ ds_err_code_t ds_calloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_
  * @retval ERROR_DS_OK Operation completed as described above.
  * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
  * @retval ERROR_DS_INVALID_ARG p_ds_buffer or p_memory is NULL (or, for
- *                              size == 0, *p_memory is NULL).
+ *                              size == 0, *p_memory is NULL), or *p_memory
+ *                              is a block of ds_halloc(), whose size is
+ *                              fixed.
  * @retval ERROR_DS_TOO_BIG_CHUNK size exceeds DS_MAX_ALLOCATION_SIZE.
  * @retval ERROR_DS_MEMORY_OUT_OF_DS *p_memory lies outside this instance's
  *                                   arena.
@@ -380,14 +1104,265 @@ ds_err_code_t ds_calloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_
  */
 ds_err_code_t ds_realloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t size);
 
+/**
+ * @brief Allocate @p count blocks in one call: all of them or none.
+ *
+ * Equivalent to ds_malloc(p_sizes[i]) for every i, except that the whole
+ * batch is validated before anything is allocated — sizes, the
+ * ds_malloc() precondition on every entry, and whether the spare records
+ * and free bytes could cover the batch at all — and that a failure part
+ * way through releases the blocks already placed, last first, so the
+ * trailing space they took is reclaimed. Callers need no cleanup code for
+ * a partial batch.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in, out] p_memories Array of @p count pointers. In: none may point
+ *                            to a live block. Out: the blocks, in the
+ *                            order of @p p_sizes; on failure no entry
+ *                            points to a block of the batch (entries
+ *                            already written are set back to NULL).
+ * @param[in] p_sizes Array of @p count sizes in bytes, each
+ *                    1..DS_MAX_ALLOCATION_SIZE.
+ * @param[in] count Number of blocks; must not be 0.
+ *
+ * @retval ERROR_DS_OK Every block allocated.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG NULL arguments, count == 0 or a zero size.
+ * @retval ERROR_DS_TOO_BIG_CHUNK A size exceeds DS_MAX_ALLOCATION_SIZE.
+ * @retval ERROR_DS_PTR_ALLOC_YET An entry already points to a live block.
+ * @retval ERROR_DS_NO_ALLOCATORS Too few records for the batch; nothing
+ *                                allocated.
+ * @retval ERROR_DS_NO_MEMORY The batch does not fit; nothing allocated.
+ */
+ds_err_code_t ds_malloc_batch(dynostatic_buffer_t *p_ds_buffer, void **p_memories, const size_t *p_sizes, size_t count);
+
+/**
+ * @brief Free @p count blocks in one call: all of them or none.
+ *
+ * Every entry is checked as ds_free() would before any block is released,
+ * and an entry naming the same block as an earlier one is rejected, so a
+ * bad batch leaves every block live. The blocks are then released in one
+ * pass over the records, the one at the top of the arena last, so a run of
+ * trailing blocks is reclaimed by a single cascade rather than parked one
+ * by one.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in, out] p_memories Array of @p count pointers. In: starts of
+ *                            distinct live blocks. Out: all NULL on
+ *                            success, unchanged on failure.
+ * @param[in] count Number of blocks; must not be 0.
+ *
+ * @retval ERROR_DS_OK Every block released.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG NULL arguments, count == 0, a NULL entry, or
+ *                              an entry that is a block of ds_halloc().
+ * @retval ERROR_DS_MEMORY_OUT_OF_DS An entry lies outside the arena.
+ * @retval ERROR_DS_ALLOCATOR_NOT_FOUND An entry is not the start of a live
+ *                                      block, or repeats an earlier entry.
+ */
+ds_err_code_t ds_free_batch(dynostatic_buffer_t *p_ds_buffer, void **p_memories, size_t count);
+
+/**
+ * @brief Allocate several sub-objects laid out in one block, under a single
+ *        allocator record.
+ *
+ * The sub-objects are placed in descriptor order, each at the next address
+ * meeting its alignment, so a structure and its variable-length arrays cost
+ * one record and one search instead of one each. The first sub-object starts
+ * the block: ds_free(p_memories[0]) releases them all, and the bounds checks
+ * of ds_safe_memory_copy() / ds_safe_memory_set() see the whole block from
+ * any of them. The size requested from the engine reserves the worst-case
+ * padding for alignments above the instance's, so it is known before the
+ * block's address is. Do not ds_realloc() the block: a move would leave the
+ * other sub-object pointers behind.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in, out] p_memories Array of @p count pointers. In: p_memories[0]
+ *                            must not point to a live block. Out: one pointer
+ *                            per sub-object, in descriptor order; unchanged
+ *                            on failure.
+ * @param[in] p_descs Array of @p count sub-object descriptors.
+ * @param[in] count Number of sub-objects; must not be 0.
+ *
+ * @retval ERROR_DS_OK Block allocated; p_memories[0] is its start.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG NULL arguments, count == 0, a zero size, an
+ *                              alignment that is not a power of two, or a
+ *                              first alignment above the instance's.
+ * @retval ERROR_DS_TOO_BIG_CHUNK The laid-out block exceeds
+ *                                DS_MAX_ALLOCATION_SIZE.
+ * @retval ERROR_DS_PTR_ALLOC_YET p_memories[0] already points to a live
+ *                                block.
+ * @retval ERROR_DS_NO_ALLOCATORS All allocator records are occupied.
+ * @retval ERROR_DS_NO_MEMORY No free region can hold the block.
+ */
+ds_err_code_t ds_malloc_multi(dynostatic_buffer_t *p_ds_buffer, void **p_memories, const ds_multi_desc_t *p_descs, size_t count);
+
+/**
+ * @brief Reserve a block for a payload whose final length is not yet known;
+ *        ds_commit() trims it once the length is.
+ *
+ * Allocates @p max_size bytes like ds_malloc(), but under the chained
+ * engines (DS_ENGINE_SEGREGATED, DS_ENGINE_TLSF) takes them from the bump
+ * space at data_head rather than from a parked block, so the block is the
+ * trailing one and whatever ds_commit() trims returns to the bump space
+ * at once. When the bump space is too small it falls back to ordinary
+ * placement. DS_ENGINE_BUDDY and DS_ENGINE_BITMAP place the block as
+ * ds_malloc() does: their in-place shrink returns the surplus wherever the
+ * block sits.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in, out] p_memory In: must not point to a live block. Out: address
+ *                          of the reserved block.
+ * @param[in] max_size Upper bound of the payload in bytes; must not be 0.
+ *
+ * @retval ERROR_DS_OK Block reserved.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG p_ds_buffer or p_memory is NULL, or
+ *                              max_size is 0.
+ * @retval ERROR_DS_TOO_BIG_CHUNK max_size exceeds DS_MAX_ALLOCATION_SIZE.
+ * @retval ERROR_DS_PTR_ALLOC_YET *p_memory already points to a live block.
+ * @retval ERROR_DS_NO_ALLOCATORS All allocator records are occupied.
+ * @retval ERROR_DS_NO_MEMORY No free region can hold max_size bytes.
+ */
+ds_err_code_t ds_reserve(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t max_size);
+
+/**
+ * @brief Trim a block to the @p size bytes actually used, in place.
+ *
+ * The shrink path of ds_realloc() on its own: the block never moves and no
+ * byte is copied, and the surplus is zeroed under DS_ZERO_ON_FREE and handed
+ * back. For a block from ds_reserve() under the chained engines that lowers
+ * data_head by the surplus. Committing 0 bytes abandons the reservation: the
+ * block is freed and *p_memory set to NULL.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in, out] p_memory In: address of a live block. Out: unchanged, or
+ *                          NULL after size == 0.
+ * @param[in] size Bytes to keep: at most the block's capacity.
+ *
+ * @retval ERROR_DS_OK Block trimmed (or freed for size == 0).
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG p_ds_buffer, p_memory or *p_memory is NULL,
+ *                              @p size exceeds the block's capacity, or
+ *                              *p_memory is a block of ds_halloc().
+ * @retval ERROR_DS_MEMORY_OUT_OF_DS *p_memory lies outside this instance's
+ *                                   arena.
+ * @retval ERROR_DS_ALLOCATOR_NOT_FOUND *p_memory is not the start of a live
+ *                                      block.
+ */
+ds_err_code_t ds_commit(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t size);
+
+/**
+ * @brief Get the capacity of a live block: the bytes it may use, which can
+ *        exceed the size requested for it.
+ *
+ * Requests are rounded up to the instance's alignment, to the size grid
+ * under DS_FIT_ROUNDED, to a power of two under DS_ENGINE_BUDDY, and a
+ * reused block keeps its capacity when the remainder could not be split
+ * off. All of it is the caller's to use, and ds_realloc() within it never
+ * moves the block. Asking claims it: under DS_TRACK_REQUESTED the block's
+ * requested size is raised to the capacity, as by ds_realloc_ex(), so a
+ * moving ds_realloc() carries every reported byte over.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] p_memory Start of a live block.
+ * @param[out] p_usable_size Capacity of the block in bytes.
+ *
+ * @retval ERROR_DS_OK Capacity reported.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG A NULL argument.
+ * @retval ERROR_DS_MEMORY_OUT_OF_DS p_memory lies outside this instance's
+ *                                   arena.
+ * @retval ERROR_DS_ALLOCATOR_NOT_FOUND p_memory is not the start of a live
+ *                                      block.
+ */
+ds_err_code_t ds_usable_size(dynostatic_buffer_t *p_ds_buffer, const void *p_memory, size_t *p_usable_size);
+
+#if DS_TRACK_REQUESTED == 1u
+/**
+ * @brief Get the size last requested for a live block: the bytes it holds
+ *        live, as opposed to its capacity.
+ *
+ * The size given to the call that allocated or last resized the block:
+ * ds_malloc(), ds_realloc(), ds_commit(), the max_size of ds_reserve(), and
+ * the laid-out extent of ds_malloc_multi(). ds_realloc_ex() and
+ * ds_usable_size() hand out the whole capacity, so they record that. A
+ * moving ds_realloc() or ds_realloc_ex() copies exactly these bytes.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] p_memory Start of a live block.
+ * @param[out] p_requested_size Requested size of the block in bytes, at most
+ *                              its capacity.
+ *
+ * @retval ERROR_DS_OK Requested size reported.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG A NULL argument.
+ * @retval ERROR_DS_MEMORY_OUT_OF_DS p_memory lies outside this instance's
+ *                                   arena.
+ * @retval ERROR_DS_ALLOCATOR_NOT_FOUND p_memory is not the start of a live
+ *                                      block.
+ */
+ds_err_code_t ds_requested_size(const dynostatic_buffer_t *p_ds_buffer, const void *p_memory, size_t *p_requested_size);
+#endif
+
+/**
+ * @brief Make a block hold at least @p min_size bytes, taking up to
+ *        @p preferred_size where that costs no extra move, and report the
+ *        capacity achieved.
+ *
+ * Meant for growable arrays: ask for what is needed now as @p min_size and
+ * for an amortized target (say, twice the current capacity) as
+ * @p preferred_size, then append until the reported capacity runs out.
+ * - Capacity already >= min_size: nothing changes; the capacity is
+ *   reported.
+ * - Otherwise the block grows in place to preferred_size, or to min_size
+ *   when preferred_size does not fit. A trailing block takes as much of
+ *   the bump space as preferred_size asks for.
+ * - Otherwise it moves, as in ds_realloc(), to a block of preferred_size
+ *   (from a parked block when one is large enough), or min_size when that
+ *   cannot be placed.
+ * - *p_memory == NULL: a new block of preferred_size, or min_size.
+ *
+ * The block is never shrunk; use ds_realloc() for that. On any failure
+ * the block and *p_memory are left intact. Under DS_TRACK_REQUESTED the
+ * whole reported capacity is recorded as requested, since the caller may
+ * fill it.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in, out] p_memory In: NULL or address of a live block. Out: address
+ *                          of the block (may differ from the input).
+ * @param[in] min_size Bytes required; 1..DS_MAX_ALLOCATION_SIZE.
+ * @param[in] preferred_size Bytes wanted; at least min_size. Larger than
+ *                           DS_MAX_ALLOCATION_SIZE is taken as that cap.
+ * @param[out] p_capacity Capacity of the block on success, at least
+ *                        min_size.
+ *
+ * @retval ERROR_DS_OK Block holds at least min_size bytes.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG NULL arguments, min_size == 0,
+ *                              preferred_size < min_size, or *p_memory is a
+ *                              block of ds_halloc().
+ * @retval ERROR_DS_TOO_BIG_CHUNK min_size exceeds DS_MAX_ALLOCATION_SIZE.
+ * @retval ERROR_DS_MEMORY_OUT_OF_DS *p_memory lies outside this instance's
+ *                                   arena.
+ * @retval ERROR_DS_ALLOCATOR_NOT_FOUND *p_memory is not the start of a live
+ *                                      block.
+ * @retval ERROR_DS_NO_ALLOCATORS No free record for the moved block.
+ * @retval ERROR_DS_NO_MEMORY No region can hold min_size bytes.
+ */
+ds_err_code_t ds_realloc_ex(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size_t min_size, size_t preferred_size, size_t *p_capacity);
+
 /**
  * @brief Get the arena occupancy as a percentage (0..100, rounded down).
  *
  * Sums the PHYSICAL CAPACITIES of live blocks — sizes rounded up to
- * DS_ALIGNMENT and retained across reuse and shrinking — so the result may
+ * the alignment and retained across reuse and shrinking — so the result may
  * exceed the sum of requested sizes. Parked freed blocks count as free.
  * 0 means no live blocks; 100 means the arena is fully occupied by live
- * blocks.
+ * blocks. Constant time: reads the running total kept by every allocating,
+ * freeing and resizing call (see ds_get_memory_usage_bytes() for the exact
+ * byte count).
  *
  * @note Snapshot semantics: valid only until the next mutating call.
  *
@@ -402,6 +1377,45 @@ ds_err_code_t ds_realloc(dynostatic_buffer_t *p_ds_buffer, void **p_memory, size
  */
 ds_err_code_t ds_get_memory_usage(const dynostatic_buffer_t *p_ds_buffer, uint8_t *p_memory_usage);
 
+/**
+ * @brief Get the arena occupancy in bytes.
+ *
+ * The byte-exact counterpart of ds_get_memory_usage(): the sum of the
+ * physical capacities of all live blocks, read in constant time.
+ *
+ * @note Snapshot semantics: valid only until the next mutating call.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[out] p_memory_usage_bytes Bytes held by live blocks
+ *                                  (0..DS_BUFFER_MEMORY_SIZE).
+ *
+ * @retval ERROR_DS_OK Value successfully written.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG p_ds_buffer or p_memory_usage_bytes is NULL.
+ */
+ds_err_code_t ds_get_memory_usage_bytes(const dynostatic_buffer_t *p_ds_buffer, size_t *p_memory_usage_bytes);
+
+#if DS_TRACK_REQUESTED == 1u
+/**
+ * @brief Get the bytes live blocks were requested for.
+ *
+ * The sum of ds_requested_size() over all live blocks, read in constant
+ * time. Set against ds_get_memory_usage_bytes() it gives the internal
+ * fragmentation: capacity held by live blocks beyond what was asked for.
+ *
+ * @note Snapshot semantics: valid only until the next mutating call.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[out] p_requested_bytes Requested bytes of live blocks, at most
+ *                               the ds_get_memory_usage_bytes() value.
+ *
+ * @retval ERROR_DS_OK Value successfully written.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG p_ds_buffer or p_requested_bytes is NULL.
+ */
+ds_err_code_t ds_get_requested_bytes(const dynostatic_buffer_t *p_ds_buffer, size_t *p_requested_bytes);
+#endif
+
 /**
  * @brief Get the largest allocation size that would succeed right now.
  *
@@ -410,6 +1424,13 @@ ds_err_code_t ds_get_memory_usage(const dynostatic_buffer_t *p_ds_buffer, uint8_
  * considered: reuse of the largest parked DS_FREE block and a fresh bump
  * allocation (clamped to DS_MAX_ALLOCATION_SIZE and to the aligned usable
  * remainder — an unaligned buffer tail is excluded as unallocatable).
+ * Constant time: the largest parked capacity is maintained by the free
+ * lists rather than searched for. Under DS_ENGINE_BUDDY the reuse candidate
+ * is the block size of the highest non-empty order, one bit scan of the
+ * per-order bitmap, and the bump candidate is the chunk untouched space
+ * would yield next. Under DS_ENGINE_BITMAP the answer is the longest run of
+ * free granules, found by a pass over the granule bitmap:
+ * O(granules / 32).
  *
  * A result of 0 means no allocation of any size can currently succeed —
  * either the memory or the allocator slots are exhausted; use
@@ -455,6 +1476,373 @@ ds_err_code_t ds_get_max_new_allocation_size(const dynostatic_buffer_t *p_ds_buf
  */
 ds_err_code_t ds_get_free_allocator_cnt(const dynostatic_buffer_t *p_ds_buffer, size_t *p_free_allocators);
 
+/**
+ * @brief Select how this instance picks among parked blocks on allocation.
+ *
+ * Takes effect from the next allocation; existing blocks are untouched. The
+ * policies and their costs are described at ds_fit_policy_t, including how
+ * the other engines treat them.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] policy Placement policy to use.
+ *
+ * @retval ERROR_DS_OK Policy selected.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG p_ds_buffer is NULL or policy is not a
+ *                              ds_fit_policy_t value.
+ */
+ds_err_code_t ds_set_fit_policy(dynostatic_buffer_t *p_ds_buffer, ds_fit_policy_t policy);
+
+/**
+ * @brief Merge every run of physically adjacent parked blocks into one.
+ *
+ * Deferred counterpart of DS_COALESCE_ON_FREE: with immediate merging
+ * disabled, ds_free() stays O(1) and fragmentation is repaired here, at a
+ * time of the caller's choosing, in one pass over the physical chain. Each
+ * absorbed block's record becomes spare again. With immediate merging
+ * enabled there is nothing to merge and the call only walks the chain.
+ * Under DS_ENGINE_BUDDY only buddies may merge, and ds_free() already
+ * merges them, so the call does nothing. Nor does it under DS_ENGINE_BITMAP,
+ * where free granules are never parked apart.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ *
+ * @retval ERROR_DS_OK Parked neighbours merged.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG p_ds_buffer is NULL.
+ */
+ds_err_code_t ds_coalesce(dynostatic_buffer_t *p_ds_buffer);
+
+#if DS_HANDLES == 1u
+/**
+ * @brief Allocate a movable block of at least @p size bytes and name it by a
+ *        handle instead of a pointer.
+ *
+ * The block is placed exactly as by ds_malloc(), but ds_compact_step() may
+ * later move it while it is unlocked, so its address is only known, and only
+ * stable, between ds_hlock() and the matching ds_hunlock(). A handle costs
+ * nothing beyond its record: it is the record index plus a generation that
+ * changes whenever the record is handed to a new handle block, which makes
+ * every handle check a constant-time compare.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[out] p_handle Handle of the new block; unchanged on failure.
+ * @param[in] size Requested size in bytes (1..DS_MAX_ALLOCATION_SIZE).
+ *
+ * @retval ERROR_DS_OK Block allocated; *p_handle names it, unlocked.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG p_ds_buffer or p_handle is NULL, or size is 0.
+ * @retval ERROR_DS_TOO_BIG_CHUNK size exceeds DS_MAX_ALLOCATION_SIZE.
+ * @retval ERROR_DS_NO_ALLOCATORS All allocator records are occupied.
+ * @retval ERROR_DS_NO_MEMORY No free region can satisfy the aligned size.
+ */
+ds_err_code_t ds_halloc(dynostatic_buffer_t *p_ds_buffer, ds_handle_t *p_handle, size_t size);
+
+/**
+ * @brief Release the block named by a handle.
+ *
+ * Behaves like ds_free() on the block. The handle, and every copy of it,
+ * becomes stale: later calls with it fail with ERROR_DS_STALE_HANDLE even
+ * after the record is reused. Handles do not survive
+ * ds_deinit_allocation().
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in, out] p_handle In: handle of an unlocked block. Out:
+ *                          DS_HANDLE_NONE on success, unchanged on failure.
+ *
+ * @retval ERROR_DS_OK Block released; *p_handle is now DS_HANDLE_NONE.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG p_ds_buffer or p_handle is NULL, or *p_handle
+ *                              is DS_HANDLE_NONE.
+ * @retval ERROR_DS_STALE_HANDLE *p_handle was released already or never
+ *                               issued by this instance.
+ * @retval ERROR_DS_HANDLE_LOCKED The block is locked; unlock it first.
+ */
+ds_err_code_t ds_hfree(dynostatic_buffer_t *p_ds_buffer, ds_handle_t *p_handle);
+
+/**
+ * @brief Pin the block named by a handle and get its address.
+ *
+ * A locked block is never moved, so the pointer stays valid until the
+ * matching ds_hunlock(). Locks nest: the block moves again only once every
+ * ds_hlock() has been matched. Constant time.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] handle Handle of a live block.
+ * @param[out] p_memory Address of the block; unchanged on failure.
+ *
+ * @retval ERROR_DS_OK Block locked; *p_memory points to it.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG p_ds_buffer or p_memory is NULL, or handle is
+ *                              DS_HANDLE_NONE.
+ * @retval ERROR_DS_STALE_HANDLE handle was released already or never issued
+ *                               by this instance.
+ * @retval ERROR_DS_HANDLE_LOCKED The block already holds UINT8_MAX locks.
+ */
+ds_err_code_t ds_hlock(dynostatic_buffer_t *p_ds_buffer, ds_handle_t handle, void **p_memory);
+
+/**
+ * @brief Drop one lock taken by ds_hlock(). Pointers obtained from the
+ *        block must not be used once its last lock is dropped.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] handle Handle of a locked block.
+ *
+ * @retval ERROR_DS_OK Lock dropped.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG p_ds_buffer is NULL, handle is
+ *                              DS_HANDLE_NONE, or the block is not locked.
+ * @retval ERROR_DS_STALE_HANDLE handle was released already or never issued
+ *                               by this instance.
+ */
+ds_err_code_t ds_hunlock(dynostatic_buffer_t *p_ds_buffer, ds_handle_t handle);
+
+/**
+ * @brief Move unlocked handle blocks towards offset 0, doing a bounded
+ *        amount of work per call.
+ *
+ * Free space left behind by freed or shrunk blocks is gathered above the
+ * movable blocks, where it merges and, once it reaches the top, lowers
+ * data_head. Blocks from ds_malloc() and locked handle blocks stay put and
+ * hold back the free space directly before them. How a block moves follows
+ * the engine:
+ * - DS_ENGINE_SEGREGATED, DS_ENGINE_TLSF: a block preceded by a parked one
+ *   slides down over it, and the parked block moves up behind it, where it
+ *   merges with a parked successor or is reclaimed at the top.
+ * - DS_ENGINE_BUDDY: a block swaps places with the lowest free block of its
+ *   own order below it, and the vacated block merges with its buddy.
+ * - DS_ENGINE_BITMAP: a block moves to the lowest run of free granules that
+ *   holds it, when that run starts below it.
+ *
+ * Handle blocks are visited in record order and each move copies one whole
+ * block, so the call returns once the next move would copy more than
+ * @p budget bytes in total. At least one block is moved whenever any can be,
+ * so a budget smaller than a block still makes progress. Call it from idle
+ * time until *p_moved_bytes is 0.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] budget Bytes the call may copy; may be 0 (move one block).
+ * @param[out] p_moved_bytes Bytes copied by this call; 0 means no handle
+ *                           block can move any further.
+ *
+ * @retval ERROR_DS_OK Step done; *p_moved_bytes written.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG p_ds_buffer or p_moved_bytes is NULL.
+ */
+ds_err_code_t ds_compact_step(dynostatic_buffer_t *p_ds_buffer, size_t budget, size_t *p_moved_bytes);
+#endif
+
+/**
+ * @brief Create a pool of @p slot_count slots of @p slot_size bytes in one
+ *        block allocated from an instance.
+ *
+ * Every slot is aligned to the instance's alignment. The block also holds
+ * the pool's in-use bitmap, DS_BIT_WORDS(slot_count) words after the last
+ * slot. Constant time: neither the slots nor the bitmap are visited until
+ * slots are handed out.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in, out] p_pool Zeroed or destroyed pool structure.
+ * @param[in] slot_size Bytes per slot; rounded up to the instance's
+ *                      alignment.
+ * @param[in] slot_count Number of slots (1..DS_POOL_SLOT_NONE - 1).
+ *
+ * @retval ERROR_DS_OK Pool created with every slot free.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG p_ds_buffer or p_pool is NULL, or slot_size
+ *                              or slot_count is 0.
+ * @retval ERROR_DS_ALREADY_INIT p_pool is already created; destroy it first.
+ * @retval ERROR_DS_TOO_BIG_CHUNK The block, slots and bitmap, would exceed
+ *                                the instance's allocation cap.
+ * @retval ERROR_DS_NO_ALLOCATORS All allocator records are occupied.
+ * @retval ERROR_DS_NO_MEMORY No free region can hold the block.
+ */
+ds_err_code_t ds_pool_create(dynostatic_buffer_t *p_ds_buffer, ds_pool_t *p_pool, size_t slot_size, size_t slot_count);
+
+/**
+ * @brief Take a free slot from a pool. Constant time.
+ *
+ * @param[in, out] p_pool Created pool.
+ * @param[out] p_memory Address of the slot; unchanged on failure. Its
+ *                      contents are indeterminate.
+ *
+ * @retval ERROR_DS_OK Slot taken; *p_memory points to it.
+ * @retval ERROR_DS_NO_INIT p_pool is not created.
+ * @retval ERROR_DS_INVALID_ARG p_pool or p_memory is NULL.
+ * @retval ERROR_DS_NO_MEMORY Every slot is in use.
+ */
+ds_err_code_t ds_pool_alloc(ds_pool_t *p_pool, void **p_memory);
+
+/**
+ * @brief Return a slot to its pool. Constant time.
+ *
+ * The slot is checked against the pool's in-use bitmap, so a slot never
+ * handed out or released already is rejected. With DS_ZERO_ON_FREE enabled
+ * the slot is zeroed first, except for the four bytes of the free list
+ * link.
+ *
+ * @param[in, out] p_pool Created pool.
+ * @param[in, out] p_memory In: address of a slot taken from @p p_pool. Out:
+ *                          NULL on success, unchanged on failure.
+ *
+ * @retval ERROR_DS_OK Slot released; *p_memory is now NULL.
+ * @retval ERROR_DS_NO_INIT p_pool is not created.
+ * @retval ERROR_DS_INVALID_ARG p_pool or p_memory is NULL, or *p_memory is
+ *                              NULL.
+ * @retval ERROR_DS_MEMORY_OUT_OF_DS *p_memory lies outside the pool's block.
+ * @retval ERROR_DS_ALLOCATOR_NOT_FOUND *p_memory is inside the block but not
+ *                                      the start of a slot @p p_pool has
+ *                                      handed out and not yet taken back.
+ */
+ds_err_code_t ds_pool_free(ds_pool_t *p_pool, void **p_memory);
+
+/**
+ * @brief Destroy a pool, releasing its block with a single ds_free().
+ *
+ * Slots still in use are released with it; pointers to them must not be
+ * used afterwards. The structure is zeroed, ready for ds_pool_create(),
+ * whatever the result.
+ *
+ * @pre The pool's block is still live: neither ds_free() of it, nor
+ *      ds_reset(), nor ds_release_to_mark() to a mark taken before
+ *      ds_pool_create() released it. A release is caught only while no
+ *      block starts where the pool's did; a block allocated there since
+ *      cannot be told apart and is freed in its place.
+ *
+ * @param[in, out] p_pool Created pool.
+ *
+ * @retval ERROR_DS_OK Pool destroyed.
+ * @retval ERROR_DS_NO_INIT p_pool is not created, or its instance was
+ *                          deinitialized, which released the block already.
+ * @retval ERROR_DS_INVALID_ARG p_pool is NULL.
+ * @retval ERROR_DS_ALLOCATOR_NOT_FOUND No block starts where the pool's
+ *                                      did: it was released already,
+ *                                      against the precondition; nothing
+ *                                      is freed.
+ */
+ds_err_code_t ds_pool_destroy(ds_pool_t *p_pool);
+
+#if DS_GROUPS == 1u
+/**
+ * @brief Start a group of blocks on an instance.
+ *
+ * Picks a tag no live block carries, in one pass over the record bitmap.
+ * A group with no members yet holds no tag in the instance, so one kept
+ * empty while 65535 others are initialized may come to share its tag.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in, out] p_group Zeroed or released group structure.
+ *
+ * @retval ERROR_DS_OK Group ready for ds_group_malloc().
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG p_ds_buffer or p_group is NULL.
+ * @retval ERROR_DS_ALREADY_INIT p_group is already initialized; release it
+ *                               first.
+ */
+ds_err_code_t ds_group_init(dynostatic_buffer_t *p_ds_buffer, ds_group_t *p_group);
+
+/**
+ * @brief Allocate a block as ds_malloc() does and make it a member of a
+ *        group.
+ *
+ * @param[in, out] p_group Initialized group.
+ * @param[in, out] p_memory In: must not point to a live block. Out: the new
+ *                          block on success, unchanged on failure.
+ * @param[in] size Requested size in bytes.
+ *
+ * @retval ERROR_DS_OK Block allocated and tagged.
+ * @retval ERROR_DS_NO_INIT p_group or its instance is not initialized.
+ * @retval ERROR_DS_INVALID_ARG p_group or p_memory is NULL, or size is 0.
+ * @retval ERROR_DS_TOO_BIG_CHUNK size exceeds the instance's allocation cap.
+ * @retval ERROR_DS_PTR_ALLOC_YET *p_memory already points to a live block.
+ * @retval ERROR_DS_NO_ALLOCATORS All allocator records are occupied.
+ * @retval ERROR_DS_NO_MEMORY No free region can hold the block.
+ */
+ds_err_code_t ds_group_malloc(ds_group_t *p_group, void **p_memory, size_t size);
+
+/**
+ * @brief Release every member of a group in one pass over the records.
+ *
+ * Members are found by their tag, not looked up by address. Those below the
+ * tail are parked first, so when the tail block is a member, releasing it
+ * last reclaims the whole trailing run in one cascade. Members already
+ * released with ds_free() are not visited. The structure is zeroed, ready
+ * for ds_group_init().
+ *
+ * @param[in, out] p_group Initialized group.
+ *
+ * @retval ERROR_DS_OK Members released; pointers to them must not be used
+ *                     afterwards.
+ * @retval ERROR_DS_NO_INIT p_group is not initialized, or its instance was
+ *                          deinitialized; the structure is zeroed in that
+ *                          case too.
+ * @retval ERROR_DS_INVALID_ARG p_group is NULL.
+ */
+ds_err_code_t ds_group_free_all(ds_group_t *p_group);
+#endif
+
+/**
+ * @brief Take a checkpoint for ds_release_to_mark(). Constant time.
+ *
+ * @param[in] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[out] p_mark Checkpoint of the instance's current state.
+ *
+ * @retval ERROR_DS_OK Checkpoint taken.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG Given parameters are invalid.
+ */
+ds_err_code_t ds_get_mark(const dynostatic_buffer_t *p_ds_buffer, ds_mark_t *p_mark);
+
+/**
+ * @brief Release every block that starts at or above a checkpoint, in one
+ *        call and without a lookup per block.
+ *
+ * Blocks live when the mark was taken lie below it and survive. So do
+ * blocks allocated later in parked space below the mark, and blocks moved
+ * there by ds_compact_step(); a block that ds_realloc() moved above the
+ * mark is released with the rest. Under DS_ENGINE_BUDDY fresh space is
+ * carved a chunk at a time, so blocks later split from the chunk in use
+ * when the mark was taken lie below it and survive too. Handle blocks are released too and their
+ * handles go stale; a released pool block is treated as by ds_reset().
+ * Parked space above the mark is reclaimed along with
+ * the blocks. Under DS_ENGINE_SEGREGATED and DS_ENGINE_TLSF the cost is one
+ * step per record above the mark; under DS_ENGINE_BUDDY and
+ * DS_ENGINE_BITMAP it is one pass over the record bitmap plus an ordinary
+ * release per live block above the mark. With DS_ZERO_ON_FREE enabled the
+ * released blocks are zeroed.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ * @param[in] mark Checkpoint from ds_get_mark() on the same instance.
+ *
+ * @retval ERROR_DS_OK Blocks above the mark released; pointers into them
+ *                     must not be used afterwards.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG p_ds_buffer is NULL, or @p mark is past the
+ *                              arena or not a multiple of its alignment.
+ */
+ds_err_code_t ds_release_to_mark(dynostatic_buffer_t *p_ds_buffer, ds_mark_t mark);
+
+/**
+ * @brief Release every block at once, leaving the instance as freshly
+ *        initialized.
+ *
+ * Only the records and the bitmaps are cleared, so the cost depends on the
+ * record count, not on the number of blocks or the arena size. The
+ * arena is not zeroed unless DS_ZERO_ON_FREE is enabled, in which case the
+ * part ever handed out is. Handles of the instance go stale; record
+ * generations are kept, so later ds_halloc() calls do not revive them. A
+ * pool's block is released like any other, so the pool must be zeroed, not
+ * destroyed: ds_pool_destroy() would free a large enough block allocated
+ * where it started.
+ *
+ * @param[in, out] p_ds_buffer Pointer to dynostatic-buffer structure.
+ *
+ * @retval ERROR_DS_OK Every block released.
+ * @retval ERROR_DS_NO_INIT Dynostatic-buffer is not initialized.
+ * @retval ERROR_DS_INVALID_ARG Given parameters are invalid.
+ */
+ds_err_code_t ds_reset(dynostatic_buffer_t *p_ds_buffer);
+
 /**
  * @brief Deinitialize dynostatic-buffer.
  *
@@ -0,0 +1,368 @@
+/**
+ * @file    dynostatic-buffer.hpp
+ * @brief   Header-only C++20 front end: arenas configured by template
+ *          parameters, a standard allocator over them, an owning block and
+ *          a std::pmr::memory_resource over any instance.
+ *
+ * Each ds::static_arena holds its own arena and record storage and is set up
+ * with ds_initialize_allocation_ex(), so arenas of different sizes, record
+ * counts and alignments coexist in one program while the DS_* macros stay the
+ * same in every translation unit. The parameters only have to respect
+ * DS_MAX_ARENA_SIZE and DS_MAX_RECORD_COUNT; consider DS_EMBEDDED_STORAGE=0
+ * when every instance comes from here.
+ *
+ * @author  Jakub Brzezowski
+ * @date    2026-10-16
+ */
+
+#ifndef DYNOSTATIC_BUFFER_HPP
+#define DYNOSTATIC_BUFFER_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <utility>
+
+#include "dynostatic-buffer.h"
+
+namespace ds {
+
+/**
+ * @class static_arena
+ * @brief An allocator instance over embedded storage sized by its template
+ *        parameters.
+ *
+ * @tparam Size       Arena bytes; a multiple of Align, at most
+ *                    DS_MAX_ARENA_SIZE.
+ * @tparam Count      Records, and so the most blocks live and parked at once;
+ *                    at most DS_MAX_RECORD_COUNT.
+ * @tparam Align      Alignment of every block: a power of two no smaller than
+ *                    DS_ALIGNMENT.
+ * @tparam ZeroOnFree Zero every block's aligned extent when it is released.
+ *
+ * The instance points into itself, so it can be neither copied nor moved.
+ * Every bound the front end checks is a constant, and a request above
+ * max_allocation_size never reaches the library.
+ */
+template <std::size_t Size, std::size_t Count, std::size_t Align = DS_ALIGNMENT, bool ZeroOnFree = false>
+class static_arena {
+  public:
+    static constexpr std::size_t size = Size;             /**< Arena bytes. */
+    static constexpr std::size_t record_count = Count;    /**< Records. */
+    static constexpr std::size_t alignment = Align;       /**< Alignment of every block. */
+    static constexpr bool zero_on_free = ZeroOnFree;      /**< Released blocks are zeroed. */
+
+    /**
+     * @brief Largest single request: the whole arena, or under
+     *        DS_ENGINE_BUDDY the largest alignment-times-power-of-two chunk
+     *        that fits it.
+     */
+    static constexpr std::size_t max_allocation_size =
+        (DS_ENGINE == DS_ENGINE_BUDDY) ? (std::bit_floor(Size / Align) * Align) : Size;
+
+    static_assert(std::has_single_bit(Align) && (Align >= DS_ALIGNMENT),
+                  "Align must be a power of two no smaller than DS_ALIGNMENT");
+    static_assert((Size >= Align) && ((Size % Align) == 0u), "Size must be a positive multiple of Align");
+    static_assert(Size <= DS_MAX_ARENA_SIZE, "Size must not exceed DS_MAX_ARENA_SIZE");
+    static_assert((Count > 0u) && (Count <= DS_MAX_RECORD_COUNT), "Count must be in 1..DS_MAX_RECORD_COUNT");
+
+    /** @brief Capacity a request of @p bytes occupies at least. */
+    static constexpr std::size_t align_up(std::size_t bytes) noexcept
+    {
+        return (bytes + (Align - 1u)) & ~(Align - 1u);
+    }
+
+    static_arena() noexcept
+    {
+        const ds_config_t config = { arena_, Size, records_, sizeof(records_), Count, Align, max_allocation_size };
+        const ds_err_code_t err = ds_initialize_allocation_ex(&buffer_, &config);
+
+        /* Every rule the library checks is asserted above. */
+        assert(ERROR_DS_OK == err);
+        (void)err;
+    }
+
+    ~static_arena()
+    {
+        (void)ds_deinit_allocation(&buffer_);
+    }
+
+    static_arena(const static_arena &) = delete;
+    static_arena &operator=(const static_arena &) = delete;
+
+    /**
+     * @brief Allocate @p bytes aligned to alignment.
+     *
+     * @return The block, or nullptr when @p bytes is 0 or above
+     *         max_allocation_size, or the arena has no room or no free record.
+     */
+    [[nodiscard]] void *allocate(std::size_t bytes) noexcept
+    {
+        void *p = nullptr;
+
+        if ((bytes > 0u) && (bytes <= max_allocation_size)) {
+            (void)ds_malloc(&buffer_, &p, bytes);
+        }
+        return p;
+    }
+
+    /**
+     * @brief Release a block returned by allocate().
+     *
+     * @param[in] p     The block; nullptr is ignored.
+     * @param[in] bytes The size it was allocated with; with ZeroOnFree its
+     *                  aligned extent is zeroed first.
+     */
+    void deallocate(void *p, std::size_t bytes) noexcept
+    {
+        if (nullptr == p) {
+            return;
+        }
+        if constexpr (ZeroOnFree) {
+            std::memset(p, 0, align_up(bytes));
+        }
+        (void)ds_free(&buffer_, &p);
+    }
+
+    /** @brief The C instance, for the ds_* getters and functions. */
+    [[nodiscard]] dynostatic_buffer_t *native_handle() noexcept
+    {
+        return &buffer_;
+    }
+
+    /** @brief The C instance, for the ds_* getters. */
+    [[nodiscard]] const dynostatic_buffer_t *native_handle() const noexcept
+    {
+        return &buffer_;
+    }
+
+  private:
+    dynostatic_buffer_t buffer_{};
+    alignas(Align) std::byte arena_[Size];
+    alignas(DS_RECORD_STORAGE_ALIGN) std::byte records_[DS_RECORD_STORAGE_SIZE(Count, Size, Align)];
+};
+
+/**
+ * @class allocator
+ * @brief A standard allocator drawing from a static_arena, for containers.
+ *
+ * Copies and rebinds share the arena and compare equal. A failed request
+ * throws std::bad_alloc, or aborts when exceptions are disabled.
+ *
+ * @tparam T     Element type; alignof(T) must not exceed Arena::alignment.
+ * @tparam Arena The static_arena type.
+ */
+template <class T, class Arena>
+class allocator {
+  public:
+    using value_type = T;
+
+    static_assert(alignof(T) <= Arena::alignment, "the arena alignment is too weak for T");
+
+    explicit allocator(Arena &arena) noexcept : arena_(&arena)
+    {
+    }
+
+    template <class U>
+    allocator(const allocator<U, Arena> &other) noexcept : arena_(other.arena())
+    {
+    }
+
+    [[nodiscard]] T *allocate(std::size_t n)
+    {
+        void *p = (n <= (Arena::max_allocation_size / sizeof(T))) ? arena_->allocate(n * sizeof(T)) : nullptr;
+
+        if (nullptr == p) {
+#if defined(__cpp_exceptions)
+            throw std::bad_alloc();
+#else
+            std::abort();
+#endif
+        }
+        return static_cast<T *>(p);
+    }
+
+    void deallocate(T *p, std::size_t n) noexcept
+    {
+        arena_->deallocate(p, n * sizeof(T));
+    }
+
+    [[nodiscard]] Arena *arena() const noexcept
+    {
+        return arena_;
+    }
+
+    template <class U>
+    friend bool operator==(const allocator &lhs, const allocator<U, Arena> &rhs) noexcept
+    {
+        return lhs.arena() == rhs.arena();
+    }
+
+  private:
+    Arena *arena_;
+};
+
+/**
+ * @class unique_block
+ * @brief Move-only owner of one static_arena block, released on
+ *        destruction.
+ *
+ * A failed allocation leaves it empty, which operator bool reports.
+ *
+ * @tparam Arena The static_arena type.
+ */
+template <class Arena>
+class unique_block {
+  public:
+    unique_block() noexcept = default;
+
+    /** @brief Allocate @p bytes from @p arena; empty when that fails. */
+    unique_block(Arena &arena, std::size_t bytes) noexcept : arena_(&arena), p_(arena.allocate(bytes))
+    {
+        size_ = (nullptr != p_) ? bytes : 0u;
+    }
+
+    unique_block(unique_block &&other) noexcept
+        : arena_(std::exchange(other.arena_, nullptr)), p_(std::exchange(other.p_, nullptr)),
+          size_(std::exchange(other.size_, 0u))
+    {
+    }
+
+    unique_block &operator=(unique_block &&other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            arena_ = std::exchange(other.arena_, nullptr);
+            p_ = std::exchange(other.p_, nullptr);
+            size_ = std::exchange(other.size_, 0u);
+        }
+        return *this;
+    }
+
+    unique_block(const unique_block &) = delete;
+    unique_block &operator=(const unique_block &) = delete;
+
+    ~unique_block()
+    {
+        reset();
+    }
+
+    [[nodiscard]] void *get() const noexcept
+    {
+        return p_;
+    }
+
+    /** @brief The size the block was requested with; 0 when empty. */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    [[nodiscard]] std::span<std::byte> bytes() const noexcept
+    {
+        return { static_cast<std::byte *>(p_), size_ };
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return nullptr != p_;
+    }
+
+    /** @brief Give up ownership; release the block with Arena::deallocate(). */
+    [[nodiscard]] void *release() noexcept
+    {
+        size_ = 0u;
+        return std::exchange(p_, nullptr);
+    }
+
+    /** @brief Release the block, if any, and become empty. */
+    void reset() noexcept
+    {
+        if (nullptr != p_) {
+            arena_->deallocate(std::exchange(p_, nullptr), size_);
+        }
+        size_ = 0u;
+    }
+
+  private:
+    Arena *arena_ = nullptr;
+    void *p_ = nullptr;
+    std::size_t size_ = 0u;
+};
+
+/**
+ * @class memory_resource
+ * @brief A std::pmr::memory_resource over an initialized dynostatic_buffer_t,
+ *        for std::pmr containers.
+ *
+ * Requests the instance cannot serve — out of memory or records, or above
+ * its allocation cap — go to the upstream resource; deallocation tells the
+ * two apart by address. Every request goes through ds_aligned_malloc(), so
+ * one aligned beyond the instance's alignment is padded inside the arena
+ * and freed by its own address. Not thread-safe, like the instance.
+ */
+class memory_resource : public std::pmr::memory_resource {
+  public:
+    /**
+     * @param[in] p_ds_buffer Initialized instance; it must outlive the
+     *                        resource and every block taken from it.
+     * @param[in] p_upstream  Resource used when the instance cannot serve a
+     *                        request.
+     */
+    explicit memory_resource(dynostatic_buffer_t *p_ds_buffer,
+                             std::pmr::memory_resource *p_upstream = std::pmr::get_default_resource()) noexcept
+        : p_ds_buffer_(p_ds_buffer), p_upstream_(p_upstream)
+    {
+    }
+
+    memory_resource(const memory_resource &) = delete;
+    memory_resource &operator=(const memory_resource &) = delete;
+
+    [[nodiscard]] std::pmr::memory_resource *upstream_resource() const noexcept
+    {
+        return p_upstream_;
+    }
+
+  protected:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        void *p = nullptr;
+
+        if (ERROR_DS_OK != ds_aligned_malloc(p_ds_buffer_, &p, alignment, std::max<std::size_t>(bytes, 1u))) {
+            return p_upstream_->allocate(bytes, alignment);
+        }
+        return p;
+    }
+
+    void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+    {
+        const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(p);
+        const std::uintptr_t arena = reinterpret_cast<std::uintptr_t>(p_ds_buffer_->memory);
+
+        if ((address < arena) || ((address - arena) >= p_ds_buffer_->memory_size)) {
+            p_upstream_->deallocate(p, bytes, alignment);
+            return;
+        }
+        (void)ds_free(p_ds_buffer_, &p);
+    }
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+
+  private:
+    dynostatic_buffer_t *p_ds_buffer_;
+    std::pmr::memory_resource *p_upstream_;
+};
+
+} // namespace ds
+
+#endif /* DYNOSTATIC_BUFFER_HPP */
@@ -23,8 +23,12 @@
 #   DYNOSTATIC_BUFFER_BUILD_DIR   where the archive/objects are written
 #   DYNOSTATIC_BUFFER_CFLAGS      compile flags used to build the library
 #   DS_ZERO_ON_FREE               1 to zero freed blocks (library-private)
+#   DS_COALESCE_ON_FREE           0 to defer merging to ds_coalesce() (library-private)
 #   DS_BUFFER_MEMORY_SIZE, DS_LOG_ENABLE,
-#   DS_MAX_ALLOCATION_COUNT, DS_MAX_ALLOCATION_SIZE   layout defines
+#   DS_MAX_ALLOCATION_COUNT, DS_MAX_ALLOCATION_SIZE,
+#   DS_MAX_ARENA_SIZE, DS_MAX_RECORD_COUNT, DS_EMBEDDED_STORAGE,
+#   DS_OWNER_MAP, DS_HANDLES, DS_GROUPS,
+#   DS_TRACK_REQUESTED, DS_ENGINE                     layout defines
 #
 # Exported for the including project to use:
 #   DYNOSTATIC_BUFFER_DIR         directory of this library
@@ -63,6 +67,19 @@ DS_BUFFER_MEMORY_SIZE   ?= 1024
 DS_LOG_ENABLE           ?= 1u
 DS_MAX_ALLOCATION_COUNT ?= 10
 DS_MAX_ALLOCATION_SIZE  ?= 512
+# Upper bounds for instances set up with ds_initialize_allocation_ex(); they
+# size the record index and offset types.
+DS_MAX_ARENA_SIZE       ?= $(DS_BUFFER_MEMORY_SIZE)
+DS_MAX_RECORD_COUNT     ?= $(DS_MAX_ALLOCATION_COUNT)
+# 0 drops the embedded arena (ds_initialize_allocation_ex() only)
+DS_EMBEDDED_STORAGE     ?= 1
+DS_OWNER_MAP            ?= 0
+DS_HANDLES              ?= 0
+DS_GROUPS               ?= 0
+DS_TRACK_REQUESTED      ?= 0
+# SEGREGATED, TLSF, BUDDY or BITMAP (TLSF and BUDDY need DS_OWNER_MAP=1 and
+# DS_COALESCE_ON_FREE=1, BITMAP needs DS_OWNER_MAP=1)
+DS_ENGINE               ?= SEGREGATED
 
 DYNOSTATIC_BUFFER_INCLUDES := -I$(DYNOSTATIC_BUFFER_DIR)
 
@@ -70,7 +87,15 @@ DYNOSTATIC_BUFFER_DEFINES := \
 	-DDS_BUFFER_MEMORY_SIZE=$(DS_BUFFER_MEMORY_SIZE) \
 	-DDS_LOG_ENABLE=$(DS_LOG_ENABLE) \
 	-DDS_MAX_ALLOCATION_COUNT=$(DS_MAX_ALLOCATION_COUNT) \
-	-DDS_MAX_ALLOCATION_SIZE=$(DS_MAX_ALLOCATION_SIZE)
+	-DDS_MAX_ALLOCATION_SIZE=$(DS_MAX_ALLOCATION_SIZE) \
+	-DDS_MAX_ARENA_SIZE=$(DS_MAX_ARENA_SIZE) \
+	-DDS_MAX_RECORD_COUNT=$(DS_MAX_RECORD_COUNT) \
+	-DDS_EMBEDDED_STORAGE=$(DS_EMBEDDED_STORAGE) \
+	-DDS_OWNER_MAP=$(DS_OWNER_MAP) \
+	-DDS_HANDLES=$(DS_HANDLES) \
+	-DDS_GROUPS=$(DS_GROUPS) \
+	-DDS_TRACK_REQUESTED=$(DS_TRACK_REQUESTED) \
+	-DDS_ENGINE=DS_ENGINE_$(DS_ENGINE)
 
 # Flags a consumer must use when compiling its own code that includes the
 # public header (the defines above alter the struct layout).
@@ -78,9 +103,11 @@ DYNOSTATIC_BUFFER_CPPFLAGS := $(DYNOSTATIC_BUFFER_INCLUDES) $(DYNOSTATIC_BUFFER_
 
 # ---- Private configuration -------------------------------------------------
 
-# DS_ZERO_ON_FREE only changes ds_free()'s runtime behaviour, not the struct
-# layout, so it is applied to the library translation unit alone.
-DS_ZERO_ON_FREE ?= 0
+# DS_ZERO_ON_FREE and DS_COALESCE_ON_FREE only change ds_free()'s runtime
+# behaviour, not the struct layout, so they are applied to the library
+# translation unit alone.
+DS_ZERO_ON_FREE     ?= 0
+DS_COALESCE_ON_FREE ?= 1
 
 # Flags used to build the library itself. Self-contained (C11 is required by
 # the header) so it does not inherit a possibly C++-oriented parent CFLAGS.
@@ -96,6 +123,7 @@ dynostatic-buffer: $(DYNOSTATIC_BUFFER_A)
 $(DYNOSTATIC_BUFFER_OBJ): $(DYNOSTATIC_BUFFER_SRC) $(DYNOSTATIC_BUFFER_HDR)
 	@mkdir -p $(@D)
 	$(CC) $(DYNOSTATIC_BUFFER_CPPFLAGS) -DDS_ZERO_ON_FREE=$(DS_ZERO_ON_FREE) \
+		-DDS_COALESCE_ON_FREE=$(DS_COALESCE_ON_FREE) \
 		$(DYNOSTATIC_BUFFER_CFLAGS) -c $< -o $@
 
 $(DYNOSTATIC_BUFFER_A): $(DYNOSTATIC_BUFFER_OBJ)
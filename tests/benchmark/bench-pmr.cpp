@@ -0,0 +1,124 @@
+/**
+ * @file bench-pmr.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Request-scoped std::pmr workload on ds::memory_resource against
+ *        std::pmr::monotonic_buffer_resource and
+ *        std::pmr::unsynchronized_pool_resource.
+ *
+ * Each iteration builds a vector, a string and an unordered_map, as a request
+ * handler would, and destroys them. The monotonic resource is released after
+ * every iteration, which is how it is used per request. Run with an optional
+ * iteration count: bench-pmr [iterations].
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "dynostatic-buffer.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kArenaSize = DS_MAX_ARENA_SIZE;
+constexpr std::size_t kRecordCount = DS_MAX_RECORD_COUNT;
+
+using Arena = ds::static_arena<(kArenaSize / DS_ALIGNMENT) * DS_ALIGNMENT, kRecordCount>;
+
+/** Upstream that counts the requests the resource under test passed on. */
+class CountingResource : public std::pmr::memory_resource {
+  public:
+    std::size_t allocations = 0u;
+
+  private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+    {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+/** One request's worth of container work; returns a value to keep it live. */
+std::size_t Request(std::pmr::memory_resource *p_resource, std::size_t seed)
+{
+    std::pmr::vector<std::size_t> ids(p_resource);
+    std::pmr::string body(p_resource);
+    std::pmr::unordered_map<std::size_t, std::size_t> headers(p_resource);
+
+    for (std::size_t i = 0u; i < 16u; i++) {
+        ids.push_back(seed + i);
+    }
+    body.append("GET /status HTTP/1.1 ");
+    body.append(static_cast<std::size_t>(24u + (seed % 16u)), 'x');
+    for (std::size_t i = 0u; i < 6u; i++) {
+        headers.emplace(seed ^ i, i);
+    }
+    return ids.back() + body.size() + headers.size();
+}
+
+template <class Reset>
+void Run(const char *p_name, std::pmr::memory_resource *p_resource, const CountingResource &upstream,
+         std::size_t iterations, Reset reset)
+{
+    std::size_t sink = 0u;
+    const auto start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0u; i < iterations; i++) {
+        sink += Request(p_resource, i);
+        reset();
+    }
+
+    const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+    std::printf("%-32s %10.1f ns/request  upstream allocations: %zu  (checksum %zu)\n", p_name,
+                elapsed.count() / static_cast<double>(iterations), upstream.allocations, sink);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const std::size_t iterations = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 200000u;
+
+    if (0u == iterations) {
+        std::fprintf(stderr, "usage: %s [iterations > 0]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    {
+        static Arena arena;
+        CountingResource upstream;
+        ds::memory_resource resource(arena.native_handle(), &upstream);
+
+        Run("ds::memory_resource", &resource, upstream, iterations, [] {});
+    }
+    {
+        alignas(std::max_align_t) static std::byte buffer[kArenaSize];
+        CountingResource upstream;
+        std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer), &upstream);
+
+        Run("monotonic_buffer_resource", &resource, upstream, iterations, [&resource] { resource.release(); });
+    }
+    {
+        CountingResource upstream;
+        std::pmr::unsynchronized_pool_resource resource(&upstream);
+
+        Run("unsynchronized_pool_resource", &resource, upstream, iterations, [] {});
+    }
+    return EXIT_SUCCESS;
+}
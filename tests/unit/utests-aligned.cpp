@@ -0,0 +1,290 @@
+/**
+ * @file utests-aligned.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Unit tests for over-aligned allocation (ds_aligned_malloc(),
+ *        ds_aligned_calloc()).
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "utests-common.hpp"
+
+using dstest::DsBufferTest;
+
+class Aligned_Tests : public DsBufferTest {
+  protected:
+    void *AlignedMalloc(size_t alignment, size_t size)
+    {
+        void *p = nullptr;
+        EXPECT_EQ(ds_aligned_malloc(&buf_, &p, alignment, size), ERROR_DS_OK);
+        return p;
+    }
+
+    /** Largest power of two the arena base is a multiple of. */
+    size_t ArenaAlignment() const
+    {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(buf_.memory);
+        return static_cast<size_t>(base & (~base + 1u));
+    }
+
+    static bool IsAlignedTo(const void *p, size_t alignment)
+    {
+        return (reinterpret_cast<uintptr_t>(p) % alignment) == 0u;
+    }
+};
+
+TEST_F(Aligned_Tests, Blocks_Meet_The_Requested_Alignment)
+{
+    for (size_t alignment = DS_ALIGNMENT * 2u; alignment <= 64u; alignment *= 2u) {
+#if DS_ENGINE == DS_ENGINE_BUDDY
+        if (alignment > ArenaAlignment()) {
+            continue; /* see Buddy_Needs_An_Aligned_Arena */
+        }
+#endif
+        (void)Malloc(DS_ALIGNMENT); /* so the next free address is not aligned by chance */
+        void *p = AlignedMalloc(alignment, 24u);
+        ASSERT_NE(p, nullptr);
+        EXPECT_TRUE(IsAlignedTo(p, alignment)) << "alignment " << alignment;
+        std::memset(p, 0x7E, 24u);
+        ASSERT_EQ(ds_free(&buf_, &p), ERROR_DS_OK);
+    }
+}
+
+TEST_F(Aligned_Tests, Small_Alignment_Is_Plain_Malloc)
+{
+    void *p = AlignedMalloc(1u, 10u);
+    EXPECT_TRUE(dstest::IsAligned(p));
+    size_t usable = 0u;
+    ASSERT_EQ(ds_usable_size(&buf_, p, &usable), ERROR_DS_OK);
+    EXPECT_EQ(UsedBytes(), usable);
+    void *q = AlignedMalloc(DS_ALIGNMENT, 10u);
+    EXPECT_EQ(static_cast<uint8_t *>(q) - static_cast<uint8_t *>(p), static_cast<ptrdiff_t>(usable)); /* packed: no padding */
+}
+
+#if DS_ENGINE != DS_ENGINE_BUDDY
+TEST_F(Aligned_Tests, Padding_Is_Not_Held_By_The_Block)
+{
+    (void)Malloc(DS_ALIGNMENT);
+    void *p = AlignedMalloc(64u, 40u);
+    ASSERT_NE(p, nullptr);
+    EXPECT_TRUE(IsAlignedTo(p, 64u));
+
+    size_t usable = 0u;
+    ASSERT_EQ(ds_usable_size(&buf_, p, &usable), ERROR_DS_OK);
+    EXPECT_EQ(usable, 40u);
+    EXPECT_EQ(UsedBytes(), DS_ALIGNMENT + 40u);
+
+    /* The leading padding is free space again: a small block fits in it. */
+    void *q = Malloc(DS_ALIGNMENT);
+    EXPECT_LT(static_cast<uint8_t *>(q), static_cast<uint8_t *>(p));
+}
+#endif
+
+TEST_F(Aligned_Tests, Aligned_Block_Works_With_The_Rest_Of_The_Api)
+{
+    const size_t alignment = 32u;
+#if DS_ENGINE == DS_ENGINE_BUDDY
+    if (alignment > ArenaAlignment()) {
+        GTEST_SKIP() << "arena base not 32-byte aligned";
+    }
+#endif
+    (void)Malloc(DS_ALIGNMENT);
+    void *p = AlignedMalloc(alignment, 32u);
+    ASSERT_NE(p, nullptr);
+    size_t usable = 0u;
+    ASSERT_EQ(ds_usable_size(&buf_, p, &usable), ERROR_DS_OK);
+
+    EXPECT_EQ(ds_safe_memory_set(&buf_, p, 0x11, usable), ERROR_DS_OK);
+    EXPECT_EQ(ds_safe_memory_set(&buf_, p, 0x11, usable + 1u), ERROR_DS_NO_MEMORY);
+    ASSERT_EQ(ds_realloc(&buf_, &p, 16u), ERROR_DS_OK); /* shrinks in place */
+    EXPECT_TRUE(IsAlignedTo(p, alignment));
+    ASSERT_EQ(ds_free(&buf_, &p), ERROR_DS_OK);
+    EXPECT_EQ(UsedBytes(), DS_ALIGNMENT);
+}
+
+TEST_F(Aligned_Tests, Calloc_Zeroes_The_Array)
+{
+    const size_t alignment = 16u;
+#if DS_ENGINE == DS_ENGINE_BUDDY
+    if (alignment > ArenaAlignment()) {
+        GTEST_SKIP() << "arena base not 16-byte aligned";
+    }
+#endif
+    uint8_t *dirty = static_cast<uint8_t *>(Malloc(128u));
+    std::memset(dirty, 0xFF, 128u);
+    void *d = dirty;
+    ASSERT_EQ(ds_free(&buf_, &d), ERROR_DS_OK);
+
+    void *p = nullptr;
+    ASSERT_EQ(ds_aligned_calloc(&buf_, &p, alignment, 5u, 7u), ERROR_DS_OK);
+    EXPECT_TRUE(IsAlignedTo(p, alignment));
+    for (size_t i = 0u; i < 35u; i++) {
+        EXPECT_EQ(static_cast<uint8_t *>(p)[i], 0u);
+    }
+
+    void *q = nullptr;
+    EXPECT_EQ(ds_aligned_calloc(&buf_, &q, alignment, SIZE_MAX, 2u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_aligned_calloc(&buf_, &q, alignment, 0u, 2u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_aligned_calloc(&buf_, &q, alignment, 2u, 0u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(q, nullptr);
+}
+
+TEST_F(Aligned_Tests, Aligned_Arena_Serves_Alignments_Up_To_256)
+{
+    constexpr size_t kArenaSize = 2048u;
+    constexpr size_t kRecordCount = 32u; /* buddy splits park free halves on records */
+    alignas(256) static uint8_t arena[kArenaSize];
+    alignas(DS_RECORD_STORAGE_ALIGN) static uint8_t records[DS_RECORD_STORAGE_SIZE(kRecordCount, kArenaSize, DS_ALIGNMENT)];
+    dynostatic_buffer_t wide{};
+    ds_config_t config{};
+    config.p_memory = arena;
+    config.memory_size = sizeof(arena);
+    config.p_records = records;
+    config.records_size = sizeof(records);
+    config.record_count = kRecordCount;
+    config.alignment = DS_ALIGNMENT;
+    config.max_allocation_size = 512u;
+    ASSERT_EQ(ds_initialize_allocation_ex(&wide, &config), ERROR_DS_OK);
+
+    void *blocks[6] = { nullptr };
+    size_t n = 0u;
+    for (size_t alignment = 8u; alignment <= 256u; alignment *= 2u) {
+        void *odd = nullptr;
+        ASSERT_EQ(ds_malloc(&wide, &odd, DS_ALIGNMENT), ERROR_DS_OK);
+        ASSERT_EQ(ds_aligned_malloc(&wide, &blocks[n], alignment, 20u), ERROR_DS_OK) << "alignment " << alignment;
+        EXPECT_TRUE(IsAlignedTo(blocks[n], alignment)) << "alignment " << alignment;
+        std::memset(blocks[n], 0x42, 20u);
+        n++;
+    }
+    for (size_t i = 0u; i < n; i++) {
+        EXPECT_EQ(ds_free(&wide, &blocks[i]), ERROR_DS_OK);
+    }
+    (void)ds_deinit_allocation(&wide);
+}
+
+TEST_F(Aligned_Tests, Page_Alignment_Needs_A_Cap_Covering_The_Padding)
+{
+    constexpr size_t kPage = 4096u;
+    constexpr size_t kRecordCount = 16u; /* buddy splits park free halves on records */
+    alignas(4096) static uint8_t storage[2u * kPage];
+    alignas(DS_RECORD_STORAGE_ALIGN) static uint8_t records[DS_RECORD_STORAGE_SIZE(kRecordCount, kPage, DS_ALIGNMENT)];
+#if DS_ENGINE == DS_ENGINE_BUDDY
+    uint8_t *const base = storage; /* see Buddy_Needs_An_Aligned_Arena */
+#else
+    uint8_t *const base = &storage[64]; /* off the page, so there is padding to split off */
+#endif
+    dynostatic_buffer_t wide{};
+    ds_config_t config{};
+    config.p_memory = base;
+    config.memory_size = kPage;
+    config.p_records = records;
+    config.records_size = sizeof(records);
+    config.record_count = kRecordCount;
+    config.alignment = DS_ALIGNMENT;
+    config.max_allocation_size = kPage; /* a one-granule request plus kPage, less one granule */
+    ASSERT_EQ(ds_initialize_allocation_ex(&wide, &config), ERROR_DS_OK);
+
+    void *p = nullptr;
+    ASSERT_EQ(ds_aligned_malloc(&wide, &p, kPage, DS_ALIGNMENT), ERROR_DS_OK);
+    EXPECT_TRUE(IsAlignedTo(p, kPage));
+    std::memset(p, 0x42, DS_ALIGNMENT);
+    size_t usable = 0u;
+    ASSERT_EQ(ds_usable_size(&wide, p, &usable), ERROR_DS_OK);
+    EXPECT_EQ(usable, static_cast<size_t>(DS_ALIGNMENT));
+    EXPECT_EQ(ds_free(&wide, &p), ERROR_DS_OK);
+
+#if DS_ENGINE != DS_ENGINE_BUDDY
+    /* One granule more and the padding no longer fits under the cap. */
+    EXPECT_EQ(ds_aligned_malloc(&wide, &p, kPage, 2u * DS_ALIGNMENT), ERROR_DS_TOO_BIG_CHUNK);
+    EXPECT_EQ(p, nullptr);
+#endif
+    (void)ds_deinit_allocation(&wide);
+}
+
+#if DS_ENGINE == DS_ENGINE_BUDDY
+TEST_F(Aligned_Tests, Buddy_Needs_An_Aligned_Arena)
+{
+    const size_t alignment = ArenaAlignment() * 2u;
+    void *p = nullptr;
+
+    if (alignment <= DS_MAX_ALLOCATION_SIZE) {
+        EXPECT_EQ(ds_aligned_malloc(&buf_, &p, alignment, 8u), ERROR_DS_INVALID_ARG);
+        EXPECT_EQ(p, nullptr);
+    }
+}
+#endif
+
+#if (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
+TEST_F(Aligned_Tests, Padding_Needs_A_Spare_Record)
+{
+    for (size_t i = 0u; i < DS_MAX_ALLOCATION_COUNT - 1u; i++) {
+        (void)Malloc(DS_ALIGNMENT);
+    }
+    const size_t used = UsedBytes();
+    void *p = nullptr;
+    const ds_err_code_t ret = ds_aligned_malloc(&buf_, &p, 64u, 8u);
+
+    if (IsAlignedTo(&buf_.memory[buf_.data_head], 64u)) {
+        EXPECT_EQ(ret, ERROR_DS_OK); /* no padding needed after all */
+    } else {
+        EXPECT_EQ(ret, ERROR_DS_NO_ALLOCATORS);
+        EXPECT_EQ(p, nullptr);
+        EXPECT_EQ(UsedBytes(), used);
+        EXPECT_EQ(FreeAllocators(), 1u);
+    }
+}
+#endif
+
+#if (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
+TEST_F(Aligned_Tests, Failed_Padding_Leaves_A_Split_Hole_Whole)
+{
+    /* The block is placed in the 128-byte hole, whose split takes the last
+     * spare record; the padding then finds none. The hole must come back
+     * whole, whether or not ds_free() coalesces. */
+    const size_t lead = IsAlignedTo(&buf_.memory[DS_ALIGNMENT], 64u) ? (2u * DS_ALIGNMENT) : DS_ALIGNMENT;
+    (void)Malloc(lead);
+    void *hole = Malloc(128u);
+    for (size_t i = 0u; i < DS_MAX_ALLOCATION_COUNT - 3u; i++) {
+        (void)Malloc(DS_ALIGNMENT);
+    }
+    void *const hole_start = hole;
+    ASSERT_EQ(ds_free(&buf_, &hole), ERROR_DS_OK);
+    ASSERT_EQ(buf_.used_allocators + buf_.parked_allocators, DS_MAX_ALLOCATION_COUNT - 1u); /* one spare */
+
+    const size_t used = UsedBytes();
+    void *p = nullptr;
+    EXPECT_EQ(ds_aligned_malloc(&buf_, &p, 64u, 8u), ERROR_DS_NO_ALLOCATORS);
+    EXPECT_EQ(p, nullptr);
+    EXPECT_EQ(UsedBytes(), used);
+    EXPECT_EQ(buf_.parked_allocators, 1u);
+    EXPECT_EQ(Malloc(128u), hole_start);
+}
+#endif
+
+TEST_F(Aligned_Tests, Bad_Arguments_Are_Rejected)
+{
+    dynostatic_buffer_t uninitialized = { 0 };
+    void *p = nullptr;
+
+    EXPECT_EQ(ds_aligned_malloc(NULL, &p, 16u, 8u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_aligned_malloc(&buf_, NULL, 16u, 8u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_aligned_malloc(&buf_, &p, 16u, 0u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_aligned_malloc(&buf_, &p, 0u, 8u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_aligned_malloc(&buf_, &p, 24u, 8u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_aligned_malloc(&uninitialized, &p, 16u, 8u), ERROR_DS_NO_INIT);
+    EXPECT_EQ(ds_aligned_calloc(&uninitialized, &p, 16u, 1u, 8u), ERROR_DS_NO_INIT);
+
+    EXPECT_EQ(ds_aligned_malloc(&buf_, &p, 16u, DS_MAX_ALLOCATION_SIZE + 1u), ERROR_DS_TOO_BIG_CHUNK);
+    EXPECT_EQ(ds_aligned_malloc(&buf_, &p, DS_MAX_ALLOCATION_SIZE * 2u, 8u), ERROR_DS_TOO_BIG_CHUNK);
+#if DS_ENGINE != DS_ENGINE_BUDDY
+    /* The padding counts against the cap. */
+    EXPECT_EQ(ds_aligned_malloc(&buf_, &p, 64u, DS_MAX_ALLOCATION_SIZE), ERROR_DS_TOO_BIG_CHUNK);
+#endif
+    EXPECT_EQ(p, nullptr);
+
+    p = Malloc(8u);
+    void *const live = p;
+    EXPECT_EQ(ds_aligned_malloc(&buf_, &p, 16u, 8u), ERROR_DS_PTR_ALLOC_YET);
+    EXPECT_EQ(p, live);
+}
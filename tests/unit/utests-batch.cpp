@@ -0,0 +1,215 @@
+/**
+ * @file utests-batch.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Unit tests for all-or-nothing batches (ds_malloc_batch(),
+ *        ds_free_batch()).
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "utests-common.hpp"
+
+using dstest::DsBufferTest;
+
+class Batch_Tests : public DsBufferTest {
+  protected:
+    size_t MaxNew()
+    {
+        size_t max_new = 0u;
+        EXPECT_EQ(ds_get_max_new_allocation_size(&buf_, &max_new), ERROR_DS_OK);
+        return max_new;
+    }
+};
+
+TEST_F(Batch_Tests, Malloc_Batch_Places_Every_Block)
+{
+    const size_t sizes[] = { 16u, 64u, 32u, 128u };
+    void *blocks[4] = { nullptr, nullptr, nullptr, nullptr };
+
+    ASSERT_EQ(ds_malloc_batch(&buf_, blocks, sizes, 4u), ERROR_DS_OK);
+    EXPECT_EQ(UsedBytes(), 16u + 64u + 32u + 128u);
+    EXPECT_EQ(FreeAllocators(), static_cast<size_t>(DS_MAX_ALLOCATION_COUNT) - 4u);
+    for (size_t i = 0u; i < 4u; i++) {
+        ASSERT_NE(blocks[i], nullptr);
+        EXPECT_TRUE(dstest::IsAligned(blocks[i]));
+        std::memset(blocks[i], static_cast<int>(i + 1u), sizes[i]);
+    }
+    for (size_t i = 0u; i < 4u; i++) {
+        EXPECT_EQ(static_cast<uint8_t *>(blocks[i])[sizes[i] - 1u], i + 1u);
+    }
+    ASSERT_EQ(ds_free_batch(&buf_, blocks, 4u), ERROR_DS_OK);
+}
+
+TEST_F(Batch_Tests, Invalid_Entry_Allocates_Nothing)
+{
+    void *live = Malloc(32u);
+    void *blocks[3] = { nullptr, nullptr, nullptr };
+
+    const size_t too_big[] = { 16u, DS_MAX_ALLOCATION_SIZE + 1u, 16u };
+    EXPECT_EQ(ds_malloc_batch(&buf_, blocks, too_big, 3u), ERROR_DS_TOO_BIG_CHUNK);
+    const size_t zero[] = { 16u, 16u, 0u };
+    EXPECT_EQ(ds_malloc_batch(&buf_, blocks, zero, 3u), ERROR_DS_INVALID_ARG);
+
+    const size_t sizes[] = { 16u, 16u, 16u };
+    blocks[2] = live;
+    EXPECT_EQ(ds_malloc_batch(&buf_, blocks, sizes, 3u), ERROR_DS_PTR_ALLOC_YET);
+
+    EXPECT_EQ(UsedBytes(), 32u);
+    EXPECT_EQ(blocks[0], nullptr);
+    EXPECT_EQ(blocks[1], nullptr);
+    EXPECT_EQ(blocks[2], live);
+}
+
+TEST_F(Batch_Tests, Batch_Beyond_Capacity_Allocates_Nothing)
+{
+    for (size_t i = 0u; i < DS_MAX_ALLOCATION_COUNT - 2u; i++) {
+        (void)Malloc(16u);
+    }
+    const size_t used = UsedBytes();
+    const size_t three[] = { 16u, 16u, 16u };
+    void *blocks[3] = { nullptr, nullptr, nullptr };
+
+    EXPECT_EQ(ds_malloc_batch(&buf_, blocks, three, 3u), ERROR_DS_NO_ALLOCATORS);
+
+    const size_t huge[] = { DS_MAX_ALLOCATION_SIZE, DS_MAX_ALLOCATION_SIZE };
+    EXPECT_EQ(ds_malloc_batch(&buf_, blocks, huge, 2u), ERROR_DS_NO_MEMORY);
+
+    EXPECT_EQ(UsedBytes(), used);
+    EXPECT_EQ(FreeAllocators(), 2u);
+    EXPECT_EQ(blocks[0], nullptr);
+}
+
+TEST_F(Batch_Tests, Late_Failure_Rolls_Back)
+{
+    /* Four quarters, two of them freed: enough free bytes for the batch, but
+     * no hole holds its second block. */
+    const size_t quarter = DS_BUFFER_MEMORY_SIZE / 4u;
+    void *quarters[4];
+    for (size_t i = 0u; i < 4u; i++) {
+        quarters[i] = Malloc(quarter);
+    }
+    ASSERT_EQ(ds_free(&buf_, &quarters[0]), ERROR_DS_OK);
+    ASSERT_EQ(ds_free(&buf_, &quarters[2]), ERROR_DS_OK);
+
+    const size_t used = UsedBytes();
+    const size_t free_allocators = FreeAllocators();
+    const size_t max_new = MaxNew();
+
+    const size_t sizes[] = { quarter / 2u, quarter + (quarter / 2u) };
+    void *blocks[2] = { nullptr, nullptr };
+    EXPECT_EQ(ds_malloc_batch(&buf_, blocks, sizes, 2u), ERROR_DS_NO_MEMORY);
+
+    EXPECT_EQ(blocks[0], nullptr);
+    EXPECT_EQ(blocks[1], nullptr);
+    EXPECT_EQ(UsedBytes(), used);
+    EXPECT_EQ(FreeAllocators(), free_allocators);
+    EXPECT_EQ(MaxNew(), max_new);
+    EXPECT_NE(Malloc(quarter), nullptr); /* both holes whole again */
+    EXPECT_NE(Malloc(quarter), nullptr);
+}
+
+#if DS_ENGINE != DS_ENGINE_BUDDY
+TEST_F(Batch_Tests, Rollback_Rejoins_A_Split_Hole)
+{
+    /* The first entry splits the 64-byte hole, the second fits nowhere. The
+     * hole must come back whole, whether or not ds_free() coalesces. */
+    void *hole = Malloc(64u);
+    (void)Malloc(16u);
+    (void)Malloc(512u);
+    (void)Malloc(DS_BUFFER_MEMORY_SIZE - 624u); /* 32 bump bytes left */
+    ASSERT_EQ(ds_free(&buf_, &hole), ERROR_DS_OK);
+    void *const hole_start = buf_.memory;
+
+    const size_t free_allocators = FreeAllocators();
+    const size_t sizes[] = { 16u, 80u };
+    void *blocks[2] = { nullptr, nullptr };
+    EXPECT_EQ(ds_malloc_batch(&buf_, blocks, sizes, 2u), ERROR_DS_NO_MEMORY);
+
+    EXPECT_EQ(FreeAllocators(), free_allocators);
+    EXPECT_EQ(Malloc(64u), hole_start);
+}
+#endif
+
+TEST_F(Batch_Tests, Free_Batch_Reclaims_The_Trailing_Run)
+{
+    (void)Malloc(64u);
+    ds_mark_t mark = 0u;
+    ASSERT_EQ(ds_get_mark(&buf_, &mark), ERROR_DS_OK);
+
+    void *blocks[4];
+    for (size_t i = 0u; i < 4u; i++) {
+        blocks[i] = Malloc(32u * (i + 1u));
+    }
+    std::swap(blocks[0], blocks[3]); /* order in the batch does not matter */
+    ASSERT_EQ(ds_free_batch(&buf_, blocks, 4u), ERROR_DS_OK);
+
+    for (void *block : blocks) {
+        EXPECT_EQ(block, nullptr);
+    }
+    ds_mark_t after = SIZE_MAX;
+    ASSERT_EQ(ds_get_mark(&buf_, &after), ERROR_DS_OK);
+    EXPECT_EQ(after, mark);
+    EXPECT_EQ(UsedBytes(), 64u);
+#if DS_ENGINE != DS_ENGINE_BUDDY
+    EXPECT_EQ(FreeAllocators(), static_cast<size_t>(DS_MAX_ALLOCATION_COUNT) - 1u); /* nothing left parked */
+#endif
+}
+
+TEST_F(Batch_Tests, Bad_Entry_Frees_Nothing)
+{
+    void *first = Malloc(32u);
+    void *second = Malloc(32u);
+    uint8_t outside[8] = { 0 };
+
+    void *repeated[3] = { first, second, first };
+    EXPECT_EQ(ds_free_batch(&buf_, repeated, 3u), ERROR_DS_ALLOCATOR_NOT_FOUND);
+    void *with_null[2] = { first, nullptr };
+    EXPECT_EQ(ds_free_batch(&buf_, with_null, 2u), ERROR_DS_INVALID_ARG);
+    void *foreign[2] = { first, outside };
+    EXPECT_EQ(ds_free_batch(&buf_, foreign, 2u), ERROR_DS_MEMORY_OUT_OF_DS);
+    void *interior[2] = { first, static_cast<uint8_t *>(second) + DS_ALIGNMENT };
+    EXPECT_EQ(ds_free_batch(&buf_, interior, 2u), ERROR_DS_ALLOCATOR_NOT_FOUND);
+
+    EXPECT_EQ(UsedBytes(), 64u);
+    EXPECT_EQ(repeated[0], first);
+    EXPECT_EQ(repeated[2], first);
+
+    void *both[2] = { second, first }; /* every rejected batch left both live */
+    EXPECT_EQ(ds_free_batch(&buf_, both, 2u), ERROR_DS_OK);
+    EXPECT_EQ(UsedBytes(), 0u);
+}
+
+#if DS_HANDLES == 1u
+TEST_F(Batch_Tests, Handle_Blocks_Are_Refused)
+{
+    ds_handle_t handle = DS_HANDLE_NONE;
+    void *locked = nullptr;
+    ASSERT_EQ(ds_halloc(&buf_, &handle, 32u), ERROR_DS_OK);
+    ASSERT_EQ(ds_hlock(&buf_, handle, &locked), ERROR_DS_OK);
+    ASSERT_EQ(ds_hunlock(&buf_, handle), ERROR_DS_OK);
+
+    void *blocks[2] = { Malloc(32u), locked };
+    EXPECT_EQ(ds_free_batch(&buf_, blocks, 2u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(UsedBytes(), 64u);
+    EXPECT_EQ(ds_free_batch(&buf_, blocks, 1u), ERROR_DS_OK);
+}
+#endif
+
+TEST_F(Batch_Tests, Bad_Arguments_Are_Rejected)
+{
+    dynostatic_buffer_t uninitialized = { 0 };
+    const size_t sizes[] = { 16u };
+    void *blocks[1] = { nullptr };
+
+    EXPECT_EQ(ds_malloc_batch(NULL, blocks, sizes, 1u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_malloc_batch(&buf_, NULL, sizes, 1u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_malloc_batch(&buf_, blocks, NULL, 1u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_malloc_batch(&buf_, blocks, sizes, 0u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_malloc_batch(&uninitialized, blocks, sizes, 1u), ERROR_DS_NO_INIT);
+
+    EXPECT_EQ(ds_free_batch(NULL, blocks, 1u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_free_batch(&buf_, NULL, 1u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_free_batch(&buf_, blocks, 0u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_free_batch(&uninitialized, blocks, 1u), ERROR_DS_NO_INIT);
+}
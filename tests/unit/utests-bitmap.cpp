@@ -0,0 +1,167 @@
+/**
+ * @file utests-bitmap.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Unit tests for the granule bitmap engine. Skipped in builds of
+ *        other engines.
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "utests-common.hpp"
+
+using dstest::AlignUp;
+using dstest::DsBufferTest;
+
+class Bitmap_Tests : public DsBufferTest {
+  protected:
+    void SetUp() override
+    {
+        if (DS_ENGINE != DS_ENGINE_BITMAP) {
+            GTEST_SKIP() << "bitmap engine only";
+        }
+        DsBufferTest::SetUp();
+    }
+
+    size_t MaxNew()
+    {
+        size_t max_new = 0u;
+        EXPECT_EQ(ds_get_max_new_allocation_size(&buf_, &max_new), ERROR_DS_OK);
+        return max_new;
+    }
+
+    const size_t granule_ = AlignUp(1u);
+    const size_t granules_ = DS_BUFFER_MEMORY_SIZE / AlignUp(1u);
+};
+
+TEST_F(Bitmap_Tests, Freed_Run_Is_Reused_First_Fit_Without_A_Record)
+{
+    char *a = NULL;
+    char *b = NULL;
+    char *c = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&a), 4u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&b), 4u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&c), 4u * granule_), ERROR_DS_OK);
+    char *const b_addr = b;
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&b)), ERROR_DS_OK);
+    EXPECT_EQ(buf_.parked_allocators, 0u);
+
+    char *p = NULL;
+    char *q = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), 2u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&q), 2u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(p, b_addr);
+    EXPECT_EQ(q, b_addr + (2u * granule_));
+}
+
+TEST_F(Bitmap_Tests, Freed_Neighbours_Form_One_Run)
+{
+    char *a = NULL;
+    char *b = NULL;
+    char *guard = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&a), 4u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&b), 4u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&guard), granule_), ERROR_DS_OK);
+    char *const a_addr = a;
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&b)), ERROR_DS_OK);
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&a)), ERROR_DS_OK);
+
+    char *p = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), 8u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(p, a_addr);
+}
+
+TEST_F(Bitmap_Tests, Run_Across_Bitmap_Words_Is_Found)
+{
+    char *a = NULL;
+    char *b = NULL;
+    char *c = NULL;
+
+    /* b covers granules 10..49: the tail of word 0 and part of word 1. */
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&a), 10u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&b), 40u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&c), 10u * granule_), ERROR_DS_OK);
+    char *const b_addr = b;
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&b)), ERROR_DS_OK);
+
+    char *p = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), 40u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(p, b_addr);
+}
+
+TEST_F(Bitmap_Tests, Short_Run_Inside_A_Word_Is_Found_And_Reported)
+{
+    char *blocks[5] = { NULL, NULL, NULL, NULL, NULL };
+    const size_t sizes[5] = { 1u, 2u, 1u, granules_ / 2u, (granules_ / 2u) - 4u };
+
+    for (size_t i = 0u; i < 5u; i++) {
+        ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&blocks[i]), sizes[i] * granule_), ERROR_DS_OK);
+    }
+    ASSERT_EQ(MaxNew(), 0u);
+
+    char *const hole = blocks[1];
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&blocks[1])), ERROR_DS_OK);
+    EXPECT_EQ(MaxNew(), 2u * granule_);
+
+    char *p = NULL;
+    EXPECT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), (2u * granule_) + 1u), ERROR_DS_NO_MEMORY);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), 2u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(p, hole);
+}
+
+TEST_F(Bitmap_Tests, Data_Head_Follows_The_Highest_Live_Block)
+{
+    char *a = NULL;
+    char *b = NULL;
+    char *c = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&a), 4u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&b), 40u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&c), 4u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(buf_.data_head, 48u * granule_);
+
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&b)), ERROR_DS_OK);
+    EXPECT_EQ(buf_.data_head, 48u * granule_);
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&c)), ERROR_DS_OK);
+    EXPECT_EQ(buf_.data_head, 4u * granule_);
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&a)), ERROR_DS_OK);
+    EXPECT_EQ(buf_.data_head, 0u);
+}
+
+TEST_F(Bitmap_Tests, Realloc_Grows_In_Place_Into_Free_Granules)
+{
+    char *a = NULL;
+    char *b = NULL;
+    char *c = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&a), 4u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&b), 4u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&c), 4u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&b)), ERROR_DS_OK);
+    a[0] = 'x';
+    char *const a_addr = a;
+
+    ASSERT_EQ(ds_realloc(&buf_, reinterpret_cast<void **>(&a), 8u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(a, a_addr);
+
+    /* c now sits right behind a: one more granule moves it. */
+    ASSERT_EQ(ds_realloc(&buf_, reinterpret_cast<void **>(&a), 9u * granule_), ERROR_DS_OK);
+    EXPECT_NE(a, a_addr);
+    EXPECT_EQ(a[0], 'x');
+}
+
+TEST_F(Bitmap_Tests, Realloc_Shrink_Frees_The_Tail_Granules)
+{
+    char *a = NULL;
+    char *guard = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&a), 8u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&guard), granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_realloc(&buf_, reinterpret_cast<void **>(&a), 2u * granule_), ERROR_DS_OK);
+
+    char *p = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), 6u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(p, a + (2u * granule_));
+}
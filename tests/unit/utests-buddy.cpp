@@ -0,0 +1,180 @@
+/**
+ * @file utests-buddy.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Unit tests for the buddy engine. Skipped in builds of other
+ *        engines.
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "utests-common.hpp"
+
+using dstest::AlignUp;
+using dstest::DsBufferTest;
+
+class Buddy_Tests : public DsBufferTest {
+  protected:
+    void SetUp() override
+    {
+        if (DS_ENGINE != DS_ENGINE_BUDDY) {
+            GTEST_SKIP() << "buddy engine only";
+        }
+        DsBufferTest::SetUp();
+    }
+
+    size_t MaxNew()
+    {
+        size_t max_new = 0u;
+        EXPECT_EQ(ds_get_max_new_allocation_size(&buf_, &max_new), ERROR_DS_OK);
+        return max_new;
+    }
+
+    const size_t granule_ = AlignUp(1u);
+};
+
+TEST_F(Buddy_Tests, Capacity_Is_Rounded_Up_To_A_Power_Of_Two)
+{
+    char *p = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), (4u * granule_) + 1u), ERROR_DS_OK);
+    EXPECT_EQ(UsedBytes(), 8u * granule_);
+}
+
+TEST_F(Buddy_Tests, Fresh_Chunk_Is_Halved_Down_To_The_Request)
+{
+    char *p = NULL;
+
+    /* One granule out of a whole chunk parks one buddy per order above it. */
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), granule_), ERROR_DS_OK);
+    EXPECT_EQ(p, reinterpret_cast<char *>(buf_.memory));
+    EXPECT_EQ(buf_.data_head, static_cast<size_t>(DS_BUDDY_CHUNK_SIZE));
+
+    size_t orders = 0u;
+    for (size_t size = granule_; size < DS_BUDDY_CHUNK_SIZE; size *= 2u) {
+        orders++;
+    }
+    EXPECT_EQ(buf_.parked_allocators, orders);
+
+    /* The next granule is the parked buddy right above the first block. */
+    char *q = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&q), granule_), ERROR_DS_OK);
+    EXPECT_EQ(q, p + granule_);
+}
+
+TEST_F(Buddy_Tests, Max_New_Allocation_Comes_From_The_Highest_Order)
+{
+    char *small = NULL;
+    char *chunk = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&small), granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&chunk), DS_MAX_ALLOCATION_SIZE), ERROR_DS_OK);
+    ASSERT_EQ(buf_.data_head, static_cast<size_t>(DS_BUFFER_MEMORY_SIZE));
+
+    /* Untouched space is gone; the upper half of the first chunk is left. */
+    const size_t half = DS_BUDDY_CHUNK_SIZE / 2u;
+    EXPECT_EQ(MaxNew(), half);
+
+    char *p = NULL;
+    EXPECT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), half + 1u), ERROR_DS_NO_MEMORY);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), half), ERROR_DS_OK);
+    EXPECT_EQ(p, small + half);
+}
+
+TEST_F(Buddy_Tests, Free_Merges_Buddies_And_Reclaims_The_Chunk)
+{
+    char *a = NULL;
+    char *b = NULL;
+    char *c = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&a), granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&b), granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&c), 2u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(c, a + (2u * granule_));
+    const size_t parked = buf_.parked_allocators;
+
+    /* b and c are neighbours but not buddies: both stay parked apart. */
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&b)), ERROR_DS_OK);
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&c)), ERROR_DS_OK);
+    EXPECT_EQ(buf_.parked_allocators, parked + 2u);
+
+    /* Freeing a merges order by order back into the whole chunk. */
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&a)), ERROR_DS_OK);
+    EXPECT_EQ(buf_.parked_allocators, 0u);
+    EXPECT_EQ(buf_.data_head, 0u);
+    EXPECT_EQ(MaxNew(), static_cast<size_t>(DS_MAX_ALLOCATION_SIZE));
+}
+
+TEST_F(Buddy_Tests, Reuse_Takes_The_Lowest_Fitting_Order)
+{
+    char *a = NULL;
+    char *b = NULL;
+    char *guard = NULL;
+
+    /* Parks buddies of 1, 2, 4, ... granules above a. */
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&a), granule_), ERROR_DS_OK);
+
+    /* Three granules need the 4-granule buddy, not a split of a larger one. */
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&b), 3u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(b, a + (4u * granule_));
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&guard), 8u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(guard, a + (8u * granule_));
+}
+
+TEST_F(Buddy_Tests, Realloc_Grows_Over_Free_Upper_Buddies_In_Place)
+{
+    char *p = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), granule_), ERROR_DS_OK);
+    p[0] = 'x';
+    char *const addr = p;
+
+    ASSERT_EQ(ds_realloc(&buf_, reinterpret_cast<void **>(&p), 4u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(p, addr);
+    EXPECT_EQ(p[0], 'x');
+    EXPECT_EQ(UsedBytes(), 4u * granule_);
+}
+
+TEST_F(Buddy_Tests, Realloc_Moves_When_The_Block_Is_An_Upper_Buddy)
+{
+    char *a = NULL;
+    char *b = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&a), granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&b), granule_), ERROR_DS_OK);
+    char *const addr = b;
+
+    /* b's buddy is a, which is live: growing b cannot stay in place. */
+    ASSERT_EQ(ds_realloc(&buf_, reinterpret_cast<void **>(&b), 2u * granule_), ERROR_DS_OK);
+    EXPECT_NE(b, addr);
+}
+
+TEST_F(Buddy_Tests, Realloc_Shrink_Parks_The_Upper_Halves)
+{
+    char *p = NULL;
+    char *q = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), 8u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_realloc(&buf_, reinterpret_cast<void **>(&p), granule_), ERROR_DS_OK);
+    EXPECT_EQ(UsedBytes(), granule_);
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&q), 4u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(q, p + (4u * granule_));
+}
+
+TEST_F(Buddy_Tests, Coalesce_Leaves_Non_Buddies_Apart)
+{
+    char *a = NULL;
+    char *b = NULL;
+    char *c = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&a), granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&b), granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&c), 2u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&b)), ERROR_DS_OK);
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&c)), ERROR_DS_OK);
+    const size_t parked = buf_.parked_allocators;
+
+    ASSERT_EQ(ds_coalesce(&buf_), ERROR_DS_OK);
+    EXPECT_EQ(buf_.parked_allocators, parked);
+}
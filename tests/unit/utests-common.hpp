@@ -75,6 +75,22 @@ class DsBufferTest : public ::testing::Test {
         return p;
     }
 
+    /** Sum of the capacities of the live blocks. */
+    size_t UsedBytes()
+    {
+        size_t used = SIZE_MAX;
+        EXPECT_EQ(ds_get_memory_usage_bytes(&buf_, &used), ERROR_DS_OK);
+        return used;
+    }
+
+    /** Records available for new blocks. */
+    size_t FreeAllocators()
+    {
+        size_t free_allocators = SIZE_MAX;
+        EXPECT_EQ(ds_get_free_allocator_cnt(&buf_, &free_allocators), ERROR_DS_OK);
+        return free_allocators;
+    }
+
     dynostatic_buffer_t buf_{};
 };
 
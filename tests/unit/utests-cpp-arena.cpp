@@ -0,0 +1,287 @@
+/**
+ * @file utests-cpp-arena.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Unit tests for the header-only C++ front end: ds::static_arena,
+ *        ds::allocator, ds::unique_block and ds::memory_resource.
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "utests-common.hpp"
+
+#include "dynostatic-buffer.hpp"
+
+#include <list>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using SmallArena = ds::static_arena<512u, 8u>;
+using WideArena = ds::static_arena<1024u, 16u, 64u>;
+using ScrubArena = ds::static_arena<256u, 4u, DS_ALIGNMENT, true>;
+
+static_assert(SmallArena::max_allocation_size == 512u);
+static_assert(WideArena::align_up(1u) == 64u);
+static_assert(!std::is_copy_constructible_v<SmallArena> && !std::is_move_constructible_v<SmallArena>);
+static_assert(!std::is_copy_constructible_v<ds::unique_block<SmallArena>>);
+static_assert(std::is_nothrow_move_constructible_v<ds::unique_block<SmallArena>>);
+
+template <class Arena>
+size_t UsedBytes(const Arena &arena)
+{
+    size_t used = SIZE_MAX;
+    EXPECT_EQ(ds_get_memory_usage_bytes(arena.native_handle(), &used), ERROR_DS_OK);
+    return used;
+}
+
+/** Upstream that counts what reaches it. */
+class CountingResource : public std::pmr::memory_resource {
+  public:
+    size_t allocations = 0u;
+    size_t live = 0u;
+
+  private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        allocations++;
+        live++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+    {
+        live--;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+} // namespace
+
+TEST(Cpp_Arena_Tests, Differently_Configured_Arenas_Coexist)
+{
+    SmallArena small;
+    WideArena wide;
+
+    void *const a = small.allocate(100u);
+    void *const b = wide.allocate(100u);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 64u, 0u);
+    EXPECT_GE(UsedBytes(small), SmallArena::align_up(100u));
+    EXPECT_EQ(UsedBytes(wide), 128u);
+
+    small.deallocate(a, 100u);
+    wide.deallocate(b, 100u);
+    EXPECT_EQ(UsedBytes(small), 0u);
+    EXPECT_EQ(UsedBytes(wide), 0u);
+}
+
+TEST(Cpp_Arena_Tests, Requests_Outside_The_Bounds_Fail)
+{
+    SmallArena arena;
+
+    EXPECT_EQ(arena.allocate(0u), nullptr);
+    EXPECT_EQ(arena.allocate(SmallArena::max_allocation_size + 1u), nullptr);
+    for (size_t i = 0u; i < SmallArena::record_count; i++) {
+        EXPECT_NE(arena.allocate(DS_ALIGNMENT), nullptr);
+    }
+    EXPECT_EQ(arena.allocate(DS_ALIGNMENT), nullptr);
+}
+
+TEST(Cpp_Arena_Tests, Zero_On_Free_Scrubs_The_Aligned_Extent)
+{
+    ScrubArena arena;
+
+    auto *const p = static_cast<uint8_t *>(arena.allocate(5u));
+    ASSERT_NE(p, nullptr);
+    std::memset(p, 0xA5, ScrubArena::align_up(5u));
+    arena.deallocate(p, 5u);
+
+    /* The arena bytes outlive the block, so they can still be inspected. */
+    for (size_t i = 0u; i < ScrubArena::align_up(5u); i++) {
+        EXPECT_EQ(p[i], 0u);
+    }
+}
+
+TEST(Cpp_Arena_Tests, Vector_Grows_Inside_The_Arena)
+{
+    SmallArena arena;
+    std::vector<int, ds::allocator<int, SmallArena>> numbers{ ds::allocator<int, SmallArena>(arena) };
+
+    for (int i = 0; i < 40; i++) {
+        numbers.push_back(i);
+    }
+    for (int i = 0; i < 40; i++) {
+        EXPECT_EQ(numbers[static_cast<size_t>(i)], i);
+    }
+    EXPECT_GE(UsedBytes(arena), 40u * sizeof(int));
+
+    numbers.clear();
+    numbers.shrink_to_fit();
+    EXPECT_EQ(UsedBytes(arena), 0u);
+}
+
+TEST(Cpp_Arena_Tests, Rebound_Allocator_Serves_List_Nodes)
+{
+    WideArena arena;
+    const ds::allocator<int, WideArena> alloc(arena);
+    {
+        std::list<int, ds::allocator<int, WideArena>> values(alloc);
+        values.push_back(1);
+        values.push_back(2);
+        EXPECT_EQ(values.front() + values.back(), 3);
+        EXPECT_EQ(UsedBytes(arena), 2u * WideArena::alignment);
+    }
+    EXPECT_EQ(UsedBytes(arena), 0u);
+
+    const ds::allocator<long, WideArena> rebound(alloc);
+    EXPECT_TRUE(alloc == rebound);
+}
+
+TEST(Cpp_Arena_Tests, Exhausted_Allocator_Throws_Bad_Alloc)
+{
+    SmallArena arena;
+    ds::allocator<int, SmallArena> alloc(arena);
+
+    EXPECT_THROW((void)alloc.allocate(SmallArena::max_allocation_size / sizeof(int) + 1u), std::bad_alloc);
+    int *const p = alloc.allocate(SmallArena::max_allocation_size / sizeof(int));
+    EXPECT_THROW((void)alloc.allocate(1u), std::bad_alloc);
+    alloc.deallocate(p, SmallArena::max_allocation_size / sizeof(int));
+}
+
+TEST(Cpp_Arena_Tests, Unique_Block_Frees_On_Destruction)
+{
+    SmallArena arena;
+    {
+        ds::unique_block<SmallArena> block(arena, 64u);
+        ASSERT_TRUE(block);
+        EXPECT_EQ(block.size(), 64u);
+        EXPECT_EQ(block.bytes().size(), 64u);
+        std::memset(block.get(), 0x11, block.size());
+        EXPECT_EQ(UsedBytes(arena), 64u);
+    }
+    EXPECT_EQ(UsedBytes(arena), 0u);
+
+    ds::unique_block<SmallArena> failed(arena, SmallArena::max_allocation_size + 1u);
+    EXPECT_FALSE(failed);
+    EXPECT_EQ(failed.size(), 0u);
+}
+
+TEST(Cpp_Arena_Tests, Unique_Block_Moves_Ownership)
+{
+    SmallArena arena;
+    ds::unique_block<SmallArena> first(arena, 32u);
+    void *const p = first.get();
+
+    ds::unique_block<SmallArena> second(std::move(first));
+    EXPECT_FALSE(first);
+    EXPECT_EQ(second.get(), p);
+
+    ds::unique_block<SmallArena> third(arena, 16u);
+    third = std::move(second);
+    EXPECT_EQ(third.get(), p);
+    EXPECT_EQ(UsedBytes(arena), 32u);
+
+    void *const raw = third.release();
+    EXPECT_FALSE(third);
+    EXPECT_EQ(UsedBytes(arena), 32u);
+    arena.deallocate(raw, 32u);
+    EXPECT_EQ(UsedBytes(arena), 0u);
+}
+
+TEST(Cpp_Pmr_Tests, Containers_Stay_In_The_Arena)
+{
+    WideArena arena;
+    CountingResource upstream;
+    ds::memory_resource resource(arena.native_handle(), &upstream);
+    {
+        std::pmr::vector<int> numbers(&resource);
+        std::pmr::string text("a string long enough to leave the small buffer", &resource);
+        std::pmr::unordered_map<int, int> map(&resource);
+
+        for (int i = 0; i < 8; i++) {
+            numbers.push_back(i);
+            map.emplace(i, i * i);
+        }
+        EXPECT_EQ(numbers.back(), 7);
+        EXPECT_EQ(map.at(3), 9);
+        EXPECT_EQ(text.front(), 'a');
+        EXPECT_GT(UsedBytes(arena), 0u);
+    }
+    EXPECT_EQ(upstream.allocations, 0u);
+    EXPECT_EQ(UsedBytes(arena), 0u);
+}
+
+TEST(Cpp_Pmr_Tests, Over_Aligned_Requests_Are_Honoured)
+{
+    SmallArena arena;
+    CountingResource upstream;
+    ds::memory_resource resource(arena.native_handle(), &upstream);
+
+    void *const p = resource.allocate(24u, 64u);
+    void *const q = resource.allocate(8u, 32u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % 64u, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(q) % 32u, 0u);
+    std::memset(p, 0x3C, 24u);
+    std::memset(q, 0x3C, 8u);
+
+    resource.deallocate(q, 8u, 32u);
+    resource.deallocate(p, 24u, 64u);
+    EXPECT_EQ(upstream.allocations, 0u);
+    EXPECT_EQ(UsedBytes(arena), 0u);
+}
+
+TEST(Cpp_Pmr_Tests, Over_Aligned_Block_Is_Freed_By_Its_Own_Address)
+{
+    SmallArena arena;
+    CountingResource upstream;
+    ds::memory_resource resource(arena.native_handle(), &upstream);
+
+    void *p = resource.allocate(24u, 64u);
+    size_t usable = 0u;
+    ASSERT_EQ(ds_usable_size(arena.native_handle(), p, &usable), ERROR_DS_OK); /* no header in front */
+    EXPECT_GE(usable, 24u);
+    EXPECT_EQ(ds_free(arena.native_handle(), &p), ERROR_DS_OK);
+    EXPECT_EQ(UsedBytes(arena), 0u);
+    EXPECT_EQ(upstream.allocations, 0u);
+}
+
+TEST(Cpp_Pmr_Tests, Exhaustion_Falls_Back_To_Upstream)
+{
+    ScrubArena arena;
+    CountingResource upstream;
+    ds::memory_resource resource(arena.native_handle(), &upstream);
+
+    void *const whole = resource.allocate(ScrubArena::max_allocation_size, DS_ALIGNMENT);
+    void *const spill = resource.allocate(16u, DS_ALIGNMENT);
+    void *const big = resource.allocate(4u * ScrubArena::size, DS_ALIGNMENT);
+    EXPECT_EQ(upstream.allocations, 2u);
+    EXPECT_EQ(upstream.live, 2u);
+
+    resource.deallocate(spill, 16u, DS_ALIGNMENT);
+    resource.deallocate(big, 4u * ScrubArena::size, DS_ALIGNMENT);
+    resource.deallocate(whole, ScrubArena::max_allocation_size, DS_ALIGNMENT);
+    EXPECT_EQ(upstream.live, 0u);
+    EXPECT_EQ(UsedBytes(arena), 0u);
+}
+
+TEST(Cpp_Pmr_Tests, Resources_Are_Equal_Only_To_Themselves)
+{
+    SmallArena arena;
+    ds::memory_resource first(arena.native_handle());
+    ds::memory_resource second(arena.native_handle());
+
+    EXPECT_TRUE(first.is_equal(first));
+    EXPECT_FALSE(first.is_equal(second));
+    EXPECT_EQ(first.upstream_resource(), std::pmr::get_default_resource());
+}
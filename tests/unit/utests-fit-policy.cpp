@@ -0,0 +1,137 @@
+/**
+ * @file utests-fit-policy.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Unit tests for the selectable placement policies.
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "utests-common.hpp"
+
+using dstest::AlignUp;
+using dstest::DsBufferTest;
+
+class Fit_Policy_Tests : public DsBufferTest {
+  protected:
+    /** Parks three blocks of the given sizes, each fenced by a live one-granule
+     *  guard so coalescing cannot merge them. */
+    void ParkThree(size_t first, size_t second, size_t third)
+    {
+        const size_t sizes[3] = { first, second, third };
+
+        for (size_t i = 0u; i < 3u; i++) {
+            ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&parked_[i]), sizes[i]), ERROR_DS_OK);
+            ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&guards_[i]), granule_), ERROR_DS_OK);
+        }
+        for (size_t i = 0u; i < 3u; i++) {
+            char *p = parked_[i];
+            ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&p)), ERROR_DS_OK);
+        }
+    }
+
+    const size_t granule_ = AlignUp(1u);
+    char *parked_[3] = { NULL, NULL, NULL }; /* addresses of the parked blocks */
+    char *guards_[3] = { NULL, NULL, NULL };
+};
+
+TEST(Fit_Policy_NoFixture_Tests, Set_Fit_Policy_Bad_Input_Params)
+{
+    dynostatic_buffer_t ds_buffer = { 0 };
+
+    ASSERT_EQ(ds_set_fit_policy(NULL, DS_FIT_FIRST), ERROR_DS_INVALID_ARG);
+    ASSERT_EQ(ds_set_fit_policy(&ds_buffer, DS_FIT_FIRST), ERROR_DS_NO_INIT);
+    ASSERT_EQ(ds_set_fit_policy(&ds_buffer, static_cast<ds_fit_policy_t>(DS_FIT_ROUNDED + 1)), ERROR_DS_INVALID_ARG);
+}
+
+TEST_F(Fit_Policy_Tests, Default_Policy_After_Init)
+{
+    EXPECT_EQ(buf_.fit_policy, static_cast<uint8_t>(DS_FIT_POLICY));
+}
+
+TEST_F(Fit_Policy_Tests, First_Fit_Takes_Lowest_Address)
+{
+    if (DS_ENGINE == DS_ENGINE_TLSF) {
+        GTEST_SKIP() << "DS_ENGINE_TLSF places with its own good fit under every policy";
+    }
+    ASSERT_NO_FATAL_FAILURE(ParkThree(8u * granule_, 4u * granule_, 6u * granule_));
+    ASSERT_EQ(ds_set_fit_policy(&buf_, DS_FIT_FIRST), ERROR_DS_OK);
+
+    char *p = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), 3u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(p, parked_[0]);
+}
+
+TEST_F(Fit_Policy_Tests, Best_Fit_Takes_Smallest_Block)
+{
+    if (DS_ENGINE == DS_ENGINE_TLSF) {
+        GTEST_SKIP() << "DS_ENGINE_TLSF places with its own good fit under every policy";
+    }
+    if (DS_ENGINE == DS_ENGINE_BITMAP) {
+        GTEST_SKIP() << "DS_ENGINE_BITMAP places first fit under every policy";
+    }
+    ASSERT_NO_FATAL_FAILURE(ParkThree(8u * granule_, 4u * granule_, 6u * granule_));
+    ASSERT_EQ(ds_set_fit_policy(&buf_, DS_FIT_BEST), ERROR_DS_OK);
+
+    char *p = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), 3u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(p, parked_[1]);
+}
+
+TEST_F(Fit_Policy_Tests, Next_Fit_Resumes_After_Last_Placement)
+{
+    if (DS_ENGINE == DS_ENGINE_TLSF) {
+        GTEST_SKIP() << "DS_ENGINE_TLSF places with its own good fit under every policy";
+    }
+    if (DS_ENGINE == DS_ENGINE_BITMAP) {
+        GTEST_SKIP() << "DS_ENGINE_BITMAP places first fit under every policy";
+    }
+    ASSERT_NO_FATAL_FAILURE(ParkThree(4u * granule_, 4u * granule_, 4u * granule_));
+    ASSERT_EQ(ds_set_fit_policy(&buf_, DS_FIT_NEXT), ERROR_DS_OK);
+
+    /* The last placement was the final guard at the arena top: wrap around. */
+    char *p = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), 4u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(p, parked_[0]);
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&p)), ERROR_DS_OK);
+
+    /* First fit would take parked_[0] again; next fit moves on. */
+    char *second = NULL;
+    char *third = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&second), 4u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(second, parked_[1]);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&third), 4u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(third, parked_[2]);
+}
+
+TEST_F(Fit_Policy_Tests, Rounded_Capacity_Follows_Size_Grid)
+{
+    if (DS_ENGINE == DS_ENGINE_BITMAP) {
+        GTEST_SKIP() << "DS_ENGINE_BITMAP serves every request with its aligned size";
+    }
+    ASSERT_EQ(ds_set_fit_policy(&buf_, DS_FIT_ROUNDED), ERROR_DS_OK);
+
+    char *small = NULL;
+    char *odd = NULL;
+    char *guard = NULL;
+
+    /* Below four granules every size is a grid step; nine granules sit
+     * between the steps 8 and 10. */
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&small), 3u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&odd), 9u * granule_), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&guard), granule_), ERROR_DS_OK);
+    EXPECT_EQ(odd, small + (3u * granule_));
+    EXPECT_EQ(guard, odd + (10u * granule_));
+
+    /* Any request of the same grid step reuses the parked block whole. */
+    char *const odd_addr = odd;
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&odd)), ERROR_DS_OK);
+
+    char *again = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&again), (9u * granule_) + 1u), ERROR_DS_OK);
+    EXPECT_EQ(again, odd_addr);
+
+    uint8_t usage = 0xFF;
+    ASSERT_EQ(ds_get_memory_usage(&buf_, &usage), ERROR_DS_OK);
+    EXPECT_EQ(usage, dstest::ExpectedUsage(14u * granule_));
+}
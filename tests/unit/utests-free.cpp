@@ -120,6 +120,162 @@ TEST_F(Free_Tests, Freed_Slot_Is_Reused)
     ASSERT_EQ(p2, freed_addr);
 }
 
+TEST_F(Free_Tests, Reuse_Finds_Fit_Inside_Straddling_Class)
+{
+    /* Parked capacities of 3 and 5 granules sit in different size classes;
+     * a 4-granule request has no class that fits wholesale, so the free
+     * lists must look inside the straddling class and pick the one block
+     * that is large enough. */
+    const size_t granule = dstest::AlignUp(1u);
+    char *pa = NULL;
+    char *pb = NULL;
+    char *guard_a = NULL;
+    char *guard_b = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&pa), 3u * granule), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&guard_a), granule), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&pb), 5u * granule), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&guard_b), granule), ERROR_DS_OK);
+
+    char *const a_addr = pa;
+    char *const b_addr = pb;
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&pa)), ERROR_DS_OK);
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&pb)), ERROR_DS_OK);
+
+    char *p4 = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p4), 4u * granule), ERROR_DS_OK);
+    ASSERT_EQ(p4, b_addr);
+
+    char *p3 = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p3), 3u * granule), ERROR_DS_OK);
+    ASSERT_EQ(p3, a_addr);
+}
+
+TEST_F(Free_Tests, Reuse_Skips_Too_Small_Block_Of_Same_Class)
+{
+    /* 5 and 6 granules share a size class, but the parked block is still
+     * one granule short: the request must fall through to bump space. */
+    const size_t granule = dstest::AlignUp(1u);
+    char *pa = NULL;
+    char *guard = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&pa), 5u * granule), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&guard), granule), ERROR_DS_OK);
+
+    char *const a_addr = pa;
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&pa)), ERROR_DS_OK);
+
+    char *p = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), 6u * granule), ERROR_DS_OK);
+    ASSERT_NE(p, a_addr);
+    ASSERT_GT(p, guard);
+}
+
+TEST_F(Free_Tests, Reuse_Splits_Surplus_Into_Parked_Block)
+{
+    /* A small request reusing a large parked block takes only its aligned
+     * size; the surplus stays parked and serves the next request in place. */
+    const size_t granule = dstest::AlignUp(1u);
+    char *big = NULL;
+    char *guard = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&big), 16u * granule), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&guard), granule), ERROR_DS_OK);
+
+    char *const big_addr = big;
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&big)), ERROR_DS_OK);
+
+    char *small = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&small), granule), ERROR_DS_OK);
+    ASSERT_EQ(small, big_addr);
+
+    uint8_t usage = 0xFF;
+    ASSERT_EQ(ds_get_memory_usage(&buf_, &usage), ERROR_DS_OK);
+    EXPECT_EQ(usage, dstest::ExpectedUsage(2u * granule)); // the surplus is not counted as used
+
+    char *rest = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&rest), 15u * granule), ERROR_DS_OK);
+    ASSERT_EQ(rest, big_addr + granule);
+}
+
+TEST_F(Free_Tests, Reuse_Without_Spare_Record_Keeps_Capacity)
+{
+    if (DS_ENGINE == DS_ENGINE_BITMAP) {
+        GTEST_SKIP() << "DS_ENGINE_BITMAP needs no record for free space";
+    }
+    /* With every record taken there is nothing to describe a remainder, so
+     * reuse hands out the parked block whole rather than failing. */
+    const size_t granule = dstest::AlignUp(1u);
+    char *blocks[DS_MAX_ALLOCATION_COUNT] = {};
+
+    for (size_t i = 0; i < DS_MAX_ALLOCATION_COUNT; i++) {
+        ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&blocks[i]), 4u * granule), ERROR_DS_OK);
+    }
+
+    char *const first_addr = blocks[0];
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&blocks[0])), ERROR_DS_OK);
+
+    char *p = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), granule), ERROR_DS_OK);
+    ASSERT_EQ(p, first_addr);
+
+    uint8_t usage = 0xFF;
+    ASSERT_EQ(ds_get_memory_usage(&buf_, &usage), ERROR_DS_OK);
+    EXPECT_EQ(usage, dstest::ExpectedUsage(DS_MAX_ALLOCATION_COUNT * 4u * granule));
+}
+
+TEST(Free_NoFixture_Tests, Coalesce_Bad_Input_Params)
+{
+    dynostatic_buffer_t ds_buffer = { 0 };
+
+    ASSERT_EQ(ds_coalesce(NULL), ERROR_DS_INVALID_ARG);
+    ASSERT_EQ(ds_coalesce(&ds_buffer), ERROR_DS_NO_INIT);
+}
+
+TEST_F(Free_Tests, Coalesce_Merges_Adjacent_Parked_Blocks)
+{
+    /* Three neighbouring parked blocks, freed out of order, must serve one
+     * request as large as all of them together at the lowest address. */
+    const size_t granule = dstest::AlignUp(1u);
+    char *blocks[3] = { NULL, NULL, NULL };
+    char *guard = NULL;
+
+    for (char *&block : blocks) {
+        ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&block), 4u * granule), ERROR_DS_OK);
+    }
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&guard), granule), ERROR_DS_OK);
+
+    char *const first_addr = blocks[0];
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&blocks[2])), ERROR_DS_OK);
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&blocks[0])), ERROR_DS_OK);
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&blocks[1])), ERROR_DS_OK);
+    ASSERT_EQ(ds_coalesce(&buf_), ERROR_DS_OK); // no-op when ds_free already merged
+
+    char *p = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), 12u * granule), ERROR_DS_OK);
+    ASSERT_EQ(p, first_addr);
+}
+
+TEST_F(Free_Tests, Coalesce_Returns_Absorbed_Records)
+{
+    /* Fill every record, park two neighbours and merge them: one record is
+     * spare again, so a bump allocation succeeds where it would have hit
+     * ERROR_DS_NO_ALLOCATORS with both blocks parked separately. */
+    const size_t granule = dstest::AlignUp(1u);
+    char *blocks[DS_MAX_ALLOCATION_COUNT] = {};
+
+    for (size_t i = 0; i < DS_MAX_ALLOCATION_COUNT; i++) {
+        ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&blocks[i]), granule), ERROR_DS_OK);
+    }
+
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&blocks[0])), ERROR_DS_OK);
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&blocks[1])), ERROR_DS_OK);
+    ASSERT_EQ(ds_coalesce(&buf_), ERROR_DS_OK);
+
+    char *big = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&big), 4u * granule), ERROR_DS_OK);
+}
+
 TEST_F(Free_Tests, Real_Double_Free_Is_Rejected)
 {
     // Unlike Free_Twice_Via_Nulled_Pointer, keep an alias so the second call
@@ -245,6 +245,9 @@ TEST_F(Getter_Tests, Zero_When_Slots_Exhausted_With_Memory_Left)
 
 TEST_F(Getter_Tests, Full_Prefix_Reports_Largest_Parked_Capacity)
 {
+    if (DS_ENGINE == DS_ENGINE_BITMAP) {
+        GTEST_SKIP() << "DS_ENGINE_BITMAP needs no record for free space";
+    }
     const size_t big = AlignUp(8u);
     const size_t small = AlignUp(1u);
     ASSERT_GT(big, small) << "premise: distinct capacities";
@@ -258,9 +261,10 @@ TEST_F(Getter_Tests, Full_Prefix_Reports_Largest_Parked_Capacity)
         ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&blocks[iter]), small), ERROR_DS_OK);
     }
 
-    /* Free two non-trailing blocks of different capacities. */
+    /* Free two non-trailing, non-adjacent blocks of different capacities
+     * (adjacent ones would be merged into a single parked block). */
     ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&blocks[0])), ERROR_DS_OK);
-    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&blocks[1])), ERROR_DS_OK);
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&blocks[2])), ERROR_DS_OK);
 
     size_t v = 0u;
     ASSERT_EQ(ds_get_max_new_allocation_size(&buf_, &v), ERROR_DS_OK);
@@ -268,3 +272,30 @@ TEST_F(Getter_Tests, Full_Prefix_Reports_Largest_Parked_Capacity)
 
     AssertMaxAllocationIsTight();
 }
+
+TEST_F(Getter_Tests, Largest_Parked_Follows_Reuse_Of_The_Largest)
+{
+    if (DS_ENGINE == DS_ENGINE_BITMAP) {
+        GTEST_SKIP() << "DS_ENGINE_BITMAP needs no record for free space";
+    }
+    const size_t big = AlignUp(8u);
+    const size_t small = AlignUp(1u);
+
+    char *blocks[DS_MAX_ALLOCATION_COUNT] = { NULL };
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&blocks[0]), big), ERROR_DS_OK);
+    for (size_t iter = 1u; iter < DS_MAX_ALLOCATION_COUNT; iter++) {
+        ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&blocks[iter]), small), ERROR_DS_OK);
+    }
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&blocks[0])), ERROR_DS_OK);
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&blocks[2])), ERROR_DS_OK);
+
+    /* Taking the largest parked block back leaves the smaller one as the
+     * best reuse candidate. */
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&blocks[0]), big), ERROR_DS_OK);
+
+    size_t v = 0u;
+    ASSERT_EQ(ds_get_max_new_allocation_size(&buf_, &v), ERROR_DS_OK);
+    ASSERT_EQ(v, small);
+
+    AssertMaxAllocationIsTight();
+}
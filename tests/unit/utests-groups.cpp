@@ -0,0 +1,153 @@
+/**
+ * @file utests-groups.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Unit tests for allocation groups (ds_group_*). Built only when
+ *        DS_GROUPS is 1.
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "utests-common.hpp"
+
+#if DS_GROUPS == 1u
+
+using dstest::DsBufferTest;
+
+class Groups_Tests : public DsBufferTest {
+  protected:
+    void SetUp() override
+    {
+        DsBufferTest::SetUp();
+        ASSERT_EQ(ds_group_init(&buf_, &first_), ERROR_DS_OK);
+        ASSERT_EQ(ds_group_init(&buf_, &second_), ERROR_DS_OK);
+    }
+
+    void *GroupMalloc(ds_group_t *p_group, size_t size)
+    {
+        void *p = nullptr;
+        EXPECT_EQ(ds_group_malloc(p_group, &p, size), ERROR_DS_OK);
+        return p;
+    }
+
+    ds_group_t first_{};
+    ds_group_t second_{};
+};
+
+TEST_F(Groups_Tests, Interleaved_Groups_Are_Released_Apart)
+{
+    (void)GroupMalloc(&first_, 32u);
+    void *b1 = GroupMalloc(&second_, 32u);
+    (void)GroupMalloc(&first_, 64u);
+    void *plain = Malloc(32u);
+    (void)GroupMalloc(&first_, 32u);
+    void *b2 = GroupMalloc(&second_, 32u);
+
+    ASSERT_EQ(ds_group_free_all(&first_), ERROR_DS_OK);
+    EXPECT_EQ(first_.p_ds_buffer, nullptr);
+    EXPECT_EQ(UsedBytes(), 3u * 32u);
+
+    EXPECT_EQ(ds_free(&buf_, &b1), ERROR_DS_OK);
+    EXPECT_EQ(ds_free(&buf_, &plain), ERROR_DS_OK);
+    ASSERT_EQ(ds_group_free_all(&second_), ERROR_DS_OK);
+    EXPECT_EQ(UsedBytes(), 0u);
+    EXPECT_NE(b2, nullptr);
+}
+
+TEST_F(Groups_Tests, Trailing_Members_Are_Reclaimed_At_Once)
+{
+    (void)Malloc(64u);
+    ds_mark_t mark = 0u;
+    ASSERT_EQ(ds_get_mark(&buf_, &mark), ERROR_DS_OK);
+
+    for (size_t i = 0u; i < 4u; i++) {
+        (void)GroupMalloc(&first_, 16u * (i + 1u));
+    }
+    ASSERT_EQ(ds_group_free_all(&first_), ERROR_DS_OK);
+
+    ds_mark_t after = SIZE_MAX;
+    ASSERT_EQ(ds_get_mark(&buf_, &after), ERROR_DS_OK);
+    EXPECT_EQ(after, mark);
+    EXPECT_EQ(UsedBytes(), 64u);
+#if DS_ENGINE != DS_ENGINE_BUDDY
+    EXPECT_EQ(FreeAllocators(), static_cast<size_t>(DS_MAX_ALLOCATION_COUNT) - 1u); /* nothing left parked */
+#endif
+}
+
+TEST_F(Groups_Tests, Membership_Ends_With_The_Block)
+{
+    void *member = GroupMalloc(&first_, 32u);
+    void *const member_addr = member;
+    ASSERT_EQ(ds_free(&buf_, &member), ERROR_DS_OK);
+
+    void *reuser = Malloc(32u);
+    ASSERT_EQ(reuser, member_addr);
+    ASSERT_EQ(ds_group_free_all(&first_), ERROR_DS_OK);
+    EXPECT_EQ(ds_free(&buf_, &reuser), ERROR_DS_OK);
+}
+
+TEST_F(Groups_Tests, Moved_Member_Stays_In_Its_Group)
+{
+    void *member = GroupMalloc(&first_, 16u);
+    void *blocker = Malloc(16u);
+    std::memset(member, 0x2B, 16u);
+
+    ASSERT_EQ(ds_realloc(&buf_, &member, 200u), ERROR_DS_OK);
+    EXPECT_EQ(static_cast<uint8_t *>(member)[15], 0x2Bu);
+    ASSERT_EQ(ds_group_free_all(&first_), ERROR_DS_OK);
+    EXPECT_EQ(UsedBytes(), 16u);
+    EXPECT_EQ(ds_free(&buf_, &blocker), ERROR_DS_OK);
+}
+
+TEST_F(Groups_Tests, Tags_Of_Live_Members_Are_Not_Reused)
+{
+    (void)GroupMalloc(&first_, 16u);
+    EXPECT_NE(first_.tag, second_.tag);
+    EXPECT_NE(first_.tag, 0u);
+
+    ds_group_t third{};
+    buf_.last_group = static_cast<uint16_t>(first_.tag - 1u); /* as if the counter came round */
+    ASSERT_EQ(ds_group_init(&buf_, &third), ERROR_DS_OK);
+    EXPECT_NE(third.tag, first_.tag);
+
+    buf_.last_group = UINT16_MAX;
+    ds_group_t fourth{};
+    ASSERT_EQ(ds_group_init(&buf_, &fourth), ERROR_DS_OK);
+    EXPECT_NE(fourth.tag, 0u);
+}
+
+TEST_F(Groups_Tests, Bad_Arguments_Are_Rejected)
+{
+    dynostatic_buffer_t uninitialized = { 0 };
+    ds_group_t group{};
+    void *p = nullptr;
+
+    EXPECT_EQ(ds_group_init(NULL, &group), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_group_init(&buf_, NULL), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_group_init(&uninitialized, &group), ERROR_DS_NO_INIT);
+    EXPECT_EQ(ds_group_init(&buf_, &first_), ERROR_DS_ALREADY_INIT);
+
+    EXPECT_EQ(ds_group_malloc(NULL, &p, 8u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_group_malloc(&first_, NULL, 8u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_group_malloc(&first_, &p, 0u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_group_malloc(&group, &p, 8u), ERROR_DS_NO_INIT);
+    EXPECT_EQ(ds_group_malloc(&first_, &p, DS_MAX_ALLOCATION_SIZE + 1u), ERROR_DS_TOO_BIG_CHUNK);
+    ASSERT_EQ(ds_group_malloc(&first_, &p, 8u), ERROR_DS_OK);
+    EXPECT_EQ(ds_group_malloc(&first_, &p, 8u), ERROR_DS_PTR_ALLOC_YET);
+
+    EXPECT_EQ(ds_group_free_all(NULL), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_group_free_all(&group), ERROR_DS_NO_INIT);
+}
+
+TEST_F(Groups_Tests, Free_All_After_Deinit_Resets_The_Group)
+{
+    (void)GroupMalloc(&first_, 16u);
+    ASSERT_EQ(ds_deinit_allocation(&buf_), ERROR_DS_OK);
+
+    void *p = nullptr;
+    EXPECT_EQ(ds_group_malloc(&first_, &p, 8u), ERROR_DS_NO_INIT);
+    EXPECT_EQ(ds_group_free_all(&first_), ERROR_DS_NO_INIT);
+    EXPECT_EQ(first_.p_ds_buffer, nullptr);
+}
+
+#endif
@@ -0,0 +1,203 @@
+/**
+ * @file utests-handles.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Unit tests for handle allocations and ds_compact_step(). Built only
+ *        when DS_HANDLES is 1.
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "utests-common.hpp"
+
+#if DS_HANDLES == 1u
+
+using dstest::AlignUp;
+using dstest::DsBufferTest;
+
+class Handles_Tests : public DsBufferTest {
+  protected:
+    ds_handle_t Halloc(size_t size)
+    {
+        ds_handle_t handle = DS_HANDLE_NONE;
+        EXPECT_EQ(ds_halloc(&buf_, &handle, size), ERROR_DS_OK);
+        return handle;
+    }
+
+    /** Address of an unlocked block, read under a short lock. */
+    char *Peek(ds_handle_t handle)
+    {
+        void *p = nullptr;
+        EXPECT_EQ(ds_hlock(&buf_, handle, &p), ERROR_DS_OK);
+        EXPECT_EQ(ds_hunlock(&buf_, handle), ERROR_DS_OK);
+        return static_cast<char *>(p);
+    }
+
+    size_t CompactStep(size_t budget)
+    {
+        size_t moved = 0u;
+        EXPECT_EQ(ds_compact_step(&buf_, budget, &moved), ERROR_DS_OK);
+        return moved;
+    }
+
+    const size_t block_ = AlignUp(16u);
+};
+
+TEST_F(Handles_Tests, Halloc_Rejects_Bad_Arguments)
+{
+    ds_handle_t handle = DS_HANDLE_NONE;
+
+    EXPECT_EQ(ds_halloc(NULL, &handle, 8u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_halloc(&buf_, NULL, 8u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_halloc(&buf_, &handle, 0u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_halloc(&buf_, &handle, DS_MAX_ALLOCATION_SIZE + 1u), ERROR_DS_TOO_BIG_CHUNK);
+    EXPECT_EQ(handle, DS_HANDLE_NONE);
+}
+
+TEST_F(Handles_Tests, Lock_Returns_The_Block_And_Nests)
+{
+    ds_handle_t handle = Halloc(block_);
+    ASSERT_NE(handle, DS_HANDLE_NONE);
+
+    void *p = nullptr;
+    void *q = nullptr;
+    ASSERT_EQ(ds_hlock(&buf_, handle, &p), ERROR_DS_OK);
+    ASSERT_EQ(ds_hlock(&buf_, handle, &q), ERROR_DS_OK);
+    EXPECT_EQ(p, q);
+    EXPECT_TRUE(dstest::IsAligned(p));
+    std::memset(p, 0x5A, block_);
+
+    EXPECT_EQ(ds_hfree(&buf_, &handle), ERROR_DS_HANDLE_LOCKED);
+    EXPECT_EQ(ds_hunlock(&buf_, handle), ERROR_DS_OK);
+    EXPECT_EQ(ds_hunlock(&buf_, handle), ERROR_DS_OK);
+    EXPECT_EQ(ds_hunlock(&buf_, handle), ERROR_DS_INVALID_ARG);
+}
+
+TEST_F(Handles_Tests, Freed_Handle_Is_Stale_Even_After_Reuse)
+{
+    ds_handle_t first = Halloc(block_);
+    const ds_handle_t copy = first;
+
+    ASSERT_EQ(ds_hfree(&buf_, &first), ERROR_DS_OK);
+    EXPECT_EQ(first, DS_HANDLE_NONE);
+
+    const ds_handle_t second = Halloc(block_);
+    EXPECT_NE(second, copy);
+
+    void *p = nullptr;
+    EXPECT_EQ(ds_hlock(&buf_, copy, &p), ERROR_DS_STALE_HANDLE);
+    EXPECT_EQ(ds_hunlock(&buf_, copy), ERROR_DS_STALE_HANDLE);
+    ds_handle_t again = copy;
+    EXPECT_EQ(ds_hfree(&buf_, &again), ERROR_DS_STALE_HANDLE);
+    EXPECT_EQ(ds_hlock(&buf_, second, &p), ERROR_DS_OK);
+    EXPECT_EQ(ds_hunlock(&buf_, second), ERROR_DS_OK);
+}
+
+TEST_F(Handles_Tests, None_And_Forged_Handles_Are_Rejected)
+{
+    void *p = nullptr;
+    ds_handle_t none = DS_HANDLE_NONE;
+
+    EXPECT_EQ(ds_hlock(&buf_, DS_HANDLE_NONE, &p), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_hunlock(&buf_, DS_HANDLE_NONE), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_hfree(&buf_, &none), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_hlock(&buf_, static_cast<ds_handle_t>(0x10000u | DS_MAX_ALLOCATION_COUNT), &p),
+              ERROR_DS_STALE_HANDLE);
+
+    /* A record used by ds_malloc() is not a handle block. */
+    (void)Malloc(block_);
+    EXPECT_EQ(ds_hlock(&buf_, static_cast<ds_handle_t>(0x10000u), &p), ERROR_DS_STALE_HANDLE);
+}
+
+TEST_F(Handles_Tests, Free_And_Realloc_Reject_Handle_Blocks)
+{
+    const ds_handle_t handle = Halloc(block_);
+    void *p = Peek(handle);
+    void *q = p;
+
+    EXPECT_EQ(ds_free(&buf_, &q), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_realloc(&buf_, &q, 2u * block_), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(q, p);
+    EXPECT_EQ(Peek(handle), p);
+}
+
+TEST_F(Handles_Tests, Compaction_Closes_Holes_And_Keeps_Data)
+{
+    ds_handle_t handles[4];
+    for (size_t i = 0u; i < 4u; i++) {
+        handles[i] = Halloc(block_);
+        std::memset(Peek(handles[i]), static_cast<int>('a' + i), block_);
+    }
+    ASSERT_EQ(ds_hfree(&buf_, &handles[0]), ERROR_DS_OK);
+    ASSERT_EQ(ds_hfree(&buf_, &handles[2]), ERROR_DS_OK);
+
+    size_t total = 0u;
+    for (size_t moved = CompactStep(SIZE_MAX); moved != 0u; moved = CompactStep(SIZE_MAX)) {
+        total += moved;
+    }
+    EXPECT_EQ(total, 2u * block_);
+
+    char *const low = reinterpret_cast<char *>(buf_.memory);
+    EXPECT_EQ(Peek(handles[1]), low);
+    EXPECT_EQ(Peek(handles[3]), low + block_);
+    for (size_t b = 0u; b < block_; b++) {
+        EXPECT_EQ(low[b], 'b');
+        EXPECT_EQ(low[block_ + b], 'd');
+    }
+    if (DS_ENGINE != DS_ENGINE_BUDDY) {
+        EXPECT_EQ(buf_.data_head, 2u * block_);
+    }
+}
+
+TEST_F(Handles_Tests, Budget_Zero_Moves_One_Block_Per_Call)
+{
+    ds_handle_t handles[4];
+    for (size_t i = 0u; i < 4u; i++) {
+        handles[i] = Halloc(block_);
+    }
+    ASSERT_EQ(ds_hfree(&buf_, &handles[0]), ERROR_DS_OK);
+    ASSERT_EQ(ds_hfree(&buf_, &handles[2]), ERROR_DS_OK);
+
+    EXPECT_EQ(CompactStep(0u), block_);
+    EXPECT_EQ(CompactStep(0u), block_);
+    EXPECT_EQ(CompactStep(0u), 0u);
+}
+
+TEST_F(Handles_Tests, Locked_Block_Is_Not_Moved)
+{
+    ds_handle_t first = Halloc(block_);
+    const ds_handle_t second = Halloc(block_);
+    ASSERT_EQ(ds_hfree(&buf_, &first), ERROR_DS_OK);
+
+    void *p = nullptr;
+    ASSERT_EQ(ds_hlock(&buf_, second, &p), ERROR_DS_OK);
+    EXPECT_EQ(CompactStep(SIZE_MAX), 0u);
+    EXPECT_EQ(Peek(second), p);
+
+    ASSERT_EQ(ds_hunlock(&buf_, second), ERROR_DS_OK);
+    EXPECT_EQ(CompactStep(SIZE_MAX), block_);
+    EXPECT_EQ(Peek(second), reinterpret_cast<char *>(buf_.memory));
+}
+
+TEST_F(Handles_Tests, Malloc_Blocks_Are_Never_Moved)
+{
+    ds_handle_t first = Halloc(block_);
+    void *const raw = Malloc(block_);
+    ASSERT_EQ(ds_hfree(&buf_, &first), ERROR_DS_OK);
+
+    EXPECT_EQ(CompactStep(SIZE_MAX), 0u);
+    void *q = raw;
+    EXPECT_EQ(ds_free(&buf_, &q), ERROR_DS_OK);
+}
+
+TEST_F(Handles_Tests, Compact_Step_Rejects_Bad_Arguments)
+{
+    size_t moved = 1u;
+
+    EXPECT_EQ(ds_compact_step(NULL, 0u, &moved), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_compact_step(&buf_, 0u, NULL), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_compact_step(&buf_, 0u, &moved), ERROR_DS_OK);
+    EXPECT_EQ(moved, 0u);
+}
+
+#endif
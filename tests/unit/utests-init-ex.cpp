@@ -0,0 +1,217 @@
+/**
+ * @file utests-init-ex.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Unit tests for ds_initialize_allocation_ex(): instances over
+ *        caller-provided storage with their own size, record count,
+ *        alignment and allocation cap.
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "utests-common.hpp"
+
+namespace {
+
+constexpr size_t kArenaSize = 2048u;
+constexpr size_t kRecordCount = 16u;
+constexpr size_t kMaxAllocation = 256u;
+constexpr size_t kWideAlignment = 64u;
+
+class Init_Ex_Tests : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        std::memset(&buf_, 0, sizeof(buf_));
+        config_.p_memory = arena_;
+        config_.memory_size = sizeof(arena_);
+        config_.p_records = records_;
+        config_.records_size = sizeof(records_);
+        config_.record_count = kRecordCount;
+        config_.alignment = DS_ALIGNMENT;
+        config_.max_allocation_size = kMaxAllocation;
+    }
+
+    void TearDown() override
+    {
+        (void)ds_deinit_allocation(&buf_);
+    }
+
+    void *Malloc(size_t size)
+    {
+        void *p = nullptr;
+        EXPECT_EQ(ds_malloc(&buf_, &p, size), ERROR_DS_OK);
+        return p;
+    }
+
+    dynostatic_buffer_t buf_{};
+    ds_config_t config_{};
+    alignas(kWideAlignment) uint8_t arena_[kArenaSize];
+    alignas(DS_RECORD_STORAGE_ALIGN) uint8_t records_[DS_RECORD_STORAGE_SIZE(kRecordCount, kArenaSize, DS_ALIGNMENT)];
+};
+
+} // namespace
+
+TEST_F(Init_Ex_Tests, Blocks_Come_From_The_Given_Arena)
+{
+    ASSERT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_OK);
+
+    uint8_t *const p = static_cast<uint8_t *>(Malloc(kMaxAllocation));
+    ASSERT_NE(p, nullptr);
+    EXPECT_GE(p, arena_);
+    EXPECT_LE(p + kMaxAllocation, arena_ + kArenaSize);
+    std::memset(p, 0x5A, kMaxAllocation);
+
+    uint8_t usage = 0xFFu;
+    ASSERT_EQ(ds_get_memory_usage(&buf_, &usage), ERROR_DS_OK);
+    EXPECT_EQ(usage, (100u * kMaxAllocation) / kArenaSize);
+
+    size_t free_allocators = 0u;
+    ASSERT_EQ(ds_get_free_allocator_cnt(&buf_, &free_allocators), ERROR_DS_OK);
+    EXPECT_EQ(free_allocators, kRecordCount - 1u);
+}
+
+TEST_F(Init_Ex_Tests, Whole_Arena_Is_Allocatable)
+{
+    ASSERT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_OK);
+
+    for (size_t i = 0u; i < kArenaSize / kMaxAllocation; i++) {
+        EXPECT_NE(Malloc(kMaxAllocation), nullptr);
+    }
+    void *p = nullptr;
+    EXPECT_EQ(ds_malloc(&buf_, &p, DS_ALIGNMENT), ERROR_DS_NO_MEMORY);
+}
+
+TEST_F(Init_Ex_Tests, Own_Allocation_Cap_Applies)
+{
+    config_.max_allocation_size = 64u;
+    ASSERT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_OK);
+
+    void *p = nullptr;
+    EXPECT_EQ(ds_malloc(&buf_, &p, 65u), ERROR_DS_TOO_BIG_CHUNK);
+    EXPECT_EQ(ds_malloc(&buf_, &p, 64u), ERROR_DS_OK);
+}
+
+TEST_F(Init_Ex_Tests, Own_Record_Count_Applies)
+{
+    ASSERT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_OK);
+
+    for (size_t i = 0u; i < kRecordCount; i++) {
+        EXPECT_NE(Malloc(DS_ALIGNMENT), nullptr);
+    }
+    void *p = nullptr;
+    EXPECT_EQ(ds_malloc(&buf_, &p, DS_ALIGNMENT), ERROR_DS_NO_ALLOCATORS);
+}
+
+TEST_F(Init_Ex_Tests, Wider_Alignment_Applies_To_Every_Block)
+{
+    alignas(DS_RECORD_STORAGE_ALIGN) static uint8_t wide_records[DS_RECORD_STORAGE_SIZE(kRecordCount, kArenaSize,
+                                                                                          kWideAlignment)];
+    config_.p_records = wide_records;
+    config_.records_size = sizeof(wide_records);
+    config_.alignment = kWideAlignment;
+    ASSERT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_OK);
+
+    uint8_t *const a = static_cast<uint8_t *>(Malloc(1u));
+    uint8_t *const b = static_cast<uint8_t *>(Malloc(kWideAlignment + 1u));
+    uint8_t *const c = static_cast<uint8_t *>(Malloc(1u));
+    for (const uint8_t *p : { a, b, c }) {
+        ASSERT_NE(p, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % kWideAlignment, 0u);
+    }
+
+    void *q = b;
+    ASSERT_EQ(ds_free(&buf_, &q), ERROR_DS_OK);
+    EXPECT_NE(Malloc(2u * kWideAlignment), nullptr);
+}
+
+TEST_F(Init_Ex_Tests, Invalid_Configs_Are_Rejected)
+{
+    const ds_config_t good = config_;
+
+    EXPECT_EQ(ds_initialize_allocation_ex(NULL, &config_), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_initialize_allocation_ex(&buf_, NULL), ERROR_DS_INVALID_ARG);
+
+    config_.p_memory = NULL;
+    EXPECT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_INVALID_ARG);
+    config_ = good;
+    config_.p_records = NULL;
+    EXPECT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_INVALID_ARG);
+    config_ = good;
+    config_.p_memory = arena_ + 1u;
+    EXPECT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_INVALID_ARG);
+    config_ = good;
+    config_.p_records = records_ + 1u;
+    EXPECT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_INVALID_ARG);
+    config_ = good;
+    config_.records_size = sizeof(records_) - 1u;
+    EXPECT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_INVALID_ARG);
+    config_ = good;
+    config_.alignment = 3u * DS_ALIGNMENT;
+    EXPECT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_INVALID_ARG);
+    config_ = good;
+    config_.alignment = DS_ALIGNMENT / 2u;
+    EXPECT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_INVALID_ARG);
+    config_ = good;
+    config_.record_count = 0u;
+    EXPECT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_INVALID_ARG);
+    config_ = good;
+    config_.record_count = DS_MAX_RECORD_COUNT + 1u;
+    EXPECT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_INVALID_ARG);
+    config_ = good;
+    config_.memory_size = DS_MAX_ARENA_SIZE + DS_ALIGNMENT;
+    EXPECT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_INVALID_ARG);
+    config_ = good;
+    config_.max_allocation_size = 0u;
+    EXPECT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_INVALID_ARG);
+    config_ = good;
+    config_.max_allocation_size = kMaxAllocation + 1u;
+    EXPECT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_INVALID_ARG);
+    config_ = good;
+    config_.max_allocation_size = kArenaSize + DS_ALIGNMENT;
+    EXPECT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_INVALID_ARG);
+
+    /* None of the rejections left the instance initialized. */
+    void *p = nullptr;
+    EXPECT_EQ(ds_malloc(&buf_, &p, DS_ALIGNMENT), ERROR_DS_NO_INIT);
+}
+
+TEST_F(Init_Ex_Tests, Twice_Initialize)
+{
+    ASSERT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_OK);
+    EXPECT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_ALREADY_INIT);
+    EXPECT_EQ(ds_initialize_allocation(&buf_), ERROR_DS_ALREADY_INIT);
+}
+
+TEST_F(Init_Ex_Tests, Deinit_Then_Reinit_Restores_Capacity)
+{
+    ASSERT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_OK);
+    for (size_t i = 0u; i < kArenaSize / kMaxAllocation; i++) {
+        (void)Malloc(kMaxAllocation);
+    }
+    ASSERT_EQ(ds_deinit_allocation(&buf_), ERROR_DS_OK);
+
+    ASSERT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_OK);
+    uint8_t usage = 0xFFu;
+    ASSERT_EQ(ds_get_memory_usage(&buf_, &usage), ERROR_DS_OK);
+    EXPECT_EQ(usage, 0u);
+    EXPECT_NE(Malloc(kMaxAllocation), nullptr);
+}
+
+TEST_F(Init_Ex_Tests, Instances_Are_Independent)
+{
+    ASSERT_EQ(ds_initialize_allocation_ex(&buf_, &config_), ERROR_DS_OK);
+
+    dynostatic_buffer_t embedded = { 0 };
+    ASSERT_EQ(ds_initialize_allocation(&embedded), ERROR_DS_OK);
+
+    void *p = Malloc(kMaxAllocation);
+    void *q = nullptr;
+    ASSERT_EQ(ds_malloc(&embedded, &q, DS_MAX_ALLOCATION_SIZE), ERROR_DS_OK);
+
+    void *foreign = p;
+    EXPECT_EQ(ds_free(&embedded, &foreign), ERROR_DS_MEMORY_OUT_OF_DS);
+    EXPECT_EQ(ds_free(&buf_, &p), ERROR_DS_OK);
+    EXPECT_EQ(ds_free(&embedded, &q), ERROR_DS_OK);
+    (void)ds_deinit_allocation(&embedded);
+}
@@ -31,6 +31,19 @@ TEST(Initialization_Tests, Deinit_Then_Reinit)
     ASSERT_EQ(ds_deinit_allocation(&ds_buffer), ERROR_DS_OK);
 }
 
+/* White-box: deinit leaves the state documented for an empty arena. */
+TEST(Initialization_Tests, Deinit_Leaves_No_Tail_Record)
+{
+    dynostatic_buffer_t ds_buffer = { 0 };
+    void *p = NULL;
+
+    ASSERT_EQ(ds_initialize_allocation(&ds_buffer), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&ds_buffer, &p, 16u), ERROR_DS_OK);
+    ASSERT_EQ(ds_deinit_allocation(&ds_buffer), ERROR_DS_OK);
+    EXPECT_EQ(ds_buffer.tail_record, DS_ALLOC_IDX_NONE);
+    EXPECT_EQ(ds_buffer.data_head, 0u);
+}
+
 TEST(Initialization_Tests, Deinit_Without_Init)
 {
     dynostatic_buffer_t ds_buffer = { 0 };
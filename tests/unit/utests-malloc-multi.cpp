@@ -0,0 +1,135 @@
+/**
+ * @file utests-malloc-multi.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Unit tests for ds_malloc_multi(): several sub-objects under one
+ *        allocator record.
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "utests-common.hpp"
+
+using dstest::DsBufferTest;
+
+class Malloc_Multi_Tests : public DsBufferTest {};
+
+TEST_F(Malloc_Multi_Tests, Sub_Objects_Share_One_Record)
+{
+    const ds_multi_desc_t descs[] = {
+        { 12u, DS_ALIGNMENT },
+        { 5u, 1u },
+        { 3u * sizeof(uint16_t), alignof(uint16_t) },
+        { 2u * sizeof(uint32_t), alignof(uint32_t) },
+    };
+    void *parts[4] = { nullptr, nullptr, nullptr, nullptr };
+
+    ASSERT_EQ(ds_malloc_multi(&buf_, parts, descs, 4u), ERROR_DS_OK);
+    EXPECT_EQ(FreeAllocators(), static_cast<size_t>(DS_MAX_ALLOCATION_COUNT) - 1u);
+    EXPECT_TRUE(dstest::IsAligned(parts[0]));
+
+    /* In order, aligned and packed: 12, then 5, one byte of padding, 6, then
+     * rounded up to the next 4-byte boundary. */
+    const uint8_t *const base = static_cast<uint8_t *>(parts[0]);
+    EXPECT_EQ(static_cast<uint8_t *>(parts[1]) - base, 12);
+    EXPECT_EQ(static_cast<uint8_t *>(parts[2]) - base, 18);
+    EXPECT_EQ(static_cast<uint8_t *>(parts[3]) - base, 24);
+    EXPECT_EQ(UsedBytes(), dstest::AlignUp(32u));
+
+    for (size_t i = 0u; i < 4u; i++) {
+        std::memset(parts[i], static_cast<int>(0xA0u + i), descs[i].size);
+    }
+    for (size_t i = 0u; i < 4u; i++) {
+        EXPECT_EQ(static_cast<uint8_t *>(parts[i])[descs[i].size - 1u], 0xA0u + i);
+    }
+
+    void *second = parts[1];
+    EXPECT_EQ(ds_free(&buf_, &second), ERROR_DS_ALLOCATOR_NOT_FOUND); /* not the block start */
+    ASSERT_EQ(ds_free(&buf_, &parts[0]), ERROR_DS_OK);
+    EXPECT_EQ(UsedBytes(), 0u);
+    EXPECT_EQ(FreeAllocators(), static_cast<size_t>(DS_MAX_ALLOCATION_COUNT));
+}
+
+TEST_F(Malloc_Multi_Tests, Over_Aligned_Sub_Objects_Are_Aligned)
+{
+    (void)Malloc(DS_ALIGNMENT); /* so the next block does not start on a 64-byte boundary */
+    const ds_multi_desc_t descs[] = {
+        { 8u, DS_ALIGNMENT },
+        { 64u, 64u },
+        { 3u, 32u },
+    };
+    void *parts[3] = { nullptr, nullptr, nullptr };
+
+    ASSERT_EQ(ds_malloc_multi(&buf_, parts, descs, 3u), ERROR_DS_OK);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(parts[1]) % 64u, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(parts[2]) % 32u, 0u);
+    EXPECT_GE(static_cast<uint8_t *>(parts[1]), static_cast<uint8_t *>(parts[0]) + 8);
+    EXPECT_GE(static_cast<uint8_t *>(parts[2]), static_cast<uint8_t *>(parts[1]) + 64);
+    std::memset(parts[2], 0x11, 3u); /* inside the block: ASan would object otherwise */
+    ASSERT_EQ(ds_free(&buf_, &parts[0]), ERROR_DS_OK);
+}
+
+TEST_F(Malloc_Multi_Tests, Safe_Copy_Sees_The_Whole_Block)
+{
+    const ds_multi_desc_t descs[] = {
+        { 16u, DS_ALIGNMENT },
+        { 16u, DS_ALIGNMENT },
+    };
+    void *parts[2] = { nullptr, nullptr };
+    const uint8_t src[32] = { 0 };
+
+    ASSERT_EQ(ds_malloc_multi(&buf_, parts, descs, 2u), ERROR_DS_OK);
+    EXPECT_EQ(ds_safe_memory_copy(&buf_, parts[0], src, 32u), ERROR_DS_OK); /* spans both */
+    EXPECT_EQ(ds_safe_memory_copy(&buf_, parts[1], src, 16u), ERROR_DS_OK);
+    EXPECT_EQ(ds_safe_memory_copy(&buf_, parts[1], src, 17u), ERROR_DS_NO_MEMORY);
+}
+
+TEST_F(Malloc_Multi_Tests, Invalid_Descriptors_Are_Rejected)
+{
+    dynostatic_buffer_t uninitialized = { 0 };
+    void *parts[2] = { nullptr, nullptr };
+    const ds_multi_desc_t ok[] = { { 8u, DS_ALIGNMENT }, { 8u, DS_ALIGNMENT } };
+
+    EXPECT_EQ(ds_malloc_multi(NULL, parts, ok, 2u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_malloc_multi(&buf_, NULL, ok, 2u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_malloc_multi(&buf_, parts, NULL, 2u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_malloc_multi(&buf_, parts, ok, 0u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_malloc_multi(&uninitialized, parts, ok, 2u), ERROR_DS_NO_INIT);
+
+    const ds_multi_desc_t zero_size[] = { { 8u, DS_ALIGNMENT }, { 0u, 1u } };
+    EXPECT_EQ(ds_malloc_multi(&buf_, parts, zero_size, 2u), ERROR_DS_INVALID_ARG);
+    const ds_multi_desc_t not_pow2[] = { { 8u, DS_ALIGNMENT }, { 8u, 12u } };
+    EXPECT_EQ(ds_malloc_multi(&buf_, parts, not_pow2, 2u), ERROR_DS_INVALID_ARG);
+    const ds_multi_desc_t zero_align[] = { { 8u, 0u } };
+    EXPECT_EQ(ds_malloc_multi(&buf_, parts, zero_align, 1u), ERROR_DS_INVALID_ARG);
+    const ds_multi_desc_t first_over_aligned[] = { { 8u, DS_ALIGNMENT * 2u } };
+    EXPECT_EQ(ds_malloc_multi(&buf_, parts, first_over_aligned, 1u), ERROR_DS_INVALID_ARG);
+
+    const ds_multi_desc_t too_big[] = {
+        { DS_MAX_ALLOCATION_SIZE / 2u, DS_ALIGNMENT },
+        { DS_MAX_ALLOCATION_SIZE / 2u + 1u, 1u },
+    };
+    EXPECT_EQ(ds_malloc_multi(&buf_, parts, too_big, 2u), ERROR_DS_TOO_BIG_CHUNK);
+
+    EXPECT_EQ(parts[0], nullptr);
+    EXPECT_EQ(parts[1], nullptr);
+    EXPECT_EQ(UsedBytes(), 0u);
+
+    parts[0] = Malloc(8u);
+    void *const live = parts[0];
+    EXPECT_EQ(ds_malloc_multi(&buf_, parts, ok, 2u), ERROR_DS_PTR_ALLOC_YET);
+    EXPECT_EQ(parts[0], live);
+    EXPECT_EQ(parts[1], nullptr);
+}
+
+TEST_F(Malloc_Multi_Tests, Exactly_The_Maximum_Fits)
+{
+    const ds_multi_desc_t descs[] = {
+        { DS_MAX_ALLOCATION_SIZE / 2u, DS_ALIGNMENT },
+        { DS_MAX_ALLOCATION_SIZE / 2u, 1u },
+    };
+    void *parts[2] = { nullptr, nullptr };
+
+    ASSERT_EQ(ds_malloc_multi(&buf_, parts, descs, 2u), ERROR_DS_OK);
+    EXPECT_EQ(UsedBytes(), static_cast<size_t>(DS_MAX_ALLOCATION_SIZE));
+}
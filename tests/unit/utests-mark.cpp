@@ -0,0 +1,198 @@
+/**
+ * @file utests-mark.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Unit tests for mark/release checkpoints (ds_get_mark(),
+ *        ds_release_to_mark()) and ds_reset().
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "utests-common.hpp"
+
+using dstest::DsBufferTest;
+
+class Mark_Tests : public DsBufferTest {
+  protected:
+    ds_mark_t Mark()
+    {
+        ds_mark_t mark = SIZE_MAX;
+        EXPECT_EQ(ds_get_mark(&buf_, &mark), ERROR_DS_OK);
+        return mark;
+    }
+
+    /** Whole arena free again: every record spare and the cap allocatable. */
+    void ExpectEmpty()
+    {
+        size_t max_new = 0u;
+        EXPECT_EQ(UsedBytes(), 0u);
+        EXPECT_EQ(FreeAllocators(), static_cast<size_t>(DS_MAX_ALLOCATION_COUNT));
+        ASSERT_EQ(ds_get_max_new_allocation_size(&buf_, &max_new), ERROR_DS_OK);
+        EXPECT_EQ(max_new, static_cast<size_t>(DS_MAX_ALLOCATION_SIZE));
+    }
+};
+
+TEST_F(Mark_Tests, Release_To_Initial_Mark_Empties_The_Instance)
+{
+    const ds_mark_t mark = Mark();
+    EXPECT_EQ(mark, 0u);
+
+    for (size_t i = 0u; i < DS_MAX_ALLOCATION_COUNT; i++) {
+        (void)Malloc(32u);
+    }
+    ASSERT_EQ(ds_release_to_mark(&buf_, mark), ERROR_DS_OK);
+    ExpectEmpty();
+}
+
+#if DS_ENGINE != DS_ENGINE_BUDDY
+TEST_F(Mark_Tests, Blocks_Before_The_Mark_Survive)
+{
+    uint8_t *const kept = static_cast<uint8_t *>(Malloc(64u));
+    std::memset(kept, 0x5A, 64u);
+    const ds_mark_t mark = Mark();
+
+    void *scratch = Malloc(64u);
+    void *const scratch_addr = scratch;
+    (void)Malloc(128u);
+    ASSERT_EQ(ds_release_to_mark(&buf_, mark), ERROR_DS_OK);
+
+    EXPECT_EQ(UsedBytes(), 64u);
+    EXPECT_EQ(FreeAllocators(), static_cast<size_t>(DS_MAX_ALLOCATION_COUNT) - 1u);
+    for (size_t i = 0u; i < 64u; i++) {
+        EXPECT_EQ(kept[i], 0x5Au);
+    }
+    EXPECT_EQ(ds_free(&buf_, &scratch), ERROR_DS_ALLOCATOR_NOT_FOUND);
+    EXPECT_EQ(Malloc(64u), scratch_addr);
+}
+
+TEST_F(Mark_Tests, Nested_Marks_Unwind_In_Order)
+{
+    (void)Malloc(64u);
+    const ds_mark_t outer = Mark();
+    (void)Malloc(64u);
+    const ds_mark_t inner = Mark();
+    EXPECT_GE(inner, outer);
+    (void)Malloc(64u);
+
+    ASSERT_EQ(ds_release_to_mark(&buf_, inner), ERROR_DS_OK);
+    EXPECT_EQ(UsedBytes(), 128u);
+    ASSERT_EQ(ds_release_to_mark(&buf_, outer), ERROR_DS_OK);
+    EXPECT_EQ(UsedBytes(), 64u);
+    ASSERT_EQ(ds_release_to_mark(&buf_, outer), ERROR_DS_OK); /* nothing left above it */
+    EXPECT_EQ(UsedBytes(), 64u);
+}
+#else
+TEST_F(Mark_Tests, Buddy_Marks_Fall_On_Chunk_Boundaries)
+{
+    (void)Malloc(64u);
+    const ds_mark_t mark = Mark();
+    EXPECT_EQ(mark, static_cast<size_t>(DS_BUDDY_CHUNK_SIZE));
+
+    (void)Malloc(64u); /* split from the chunk already carved: below the mark */
+    (void)Malloc(DS_BUDDY_CHUNK_SIZE);
+    ASSERT_EQ(ds_release_to_mark(&buf_, mark), ERROR_DS_OK);
+
+    EXPECT_EQ(UsedBytes(), 128u);
+    EXPECT_EQ(Mark(), mark);
+}
+#endif
+
+TEST_F(Mark_Tests, Parked_Space_Above_The_Mark_Is_Reclaimed)
+{
+    const ds_mark_t mark = Mark();
+    (void)Malloc(64u);
+    void *middle = Malloc(128u);
+    (void)Malloc(64u);
+    ASSERT_EQ(ds_free(&buf_, &middle), ERROR_DS_OK);
+
+    ASSERT_EQ(ds_release_to_mark(&buf_, mark), ERROR_DS_OK);
+    ExpectEmpty();
+}
+
+TEST_F(Mark_Tests, Blocks_Reusing_Space_Below_The_Mark_Survive)
+{
+    void *first = Malloc(64u);
+    void *const first_addr = first;
+    (void)Malloc(64u);
+    ASSERT_EQ(ds_free(&buf_, &first), ERROR_DS_OK);
+    const ds_mark_t mark = Mark();
+
+    void *reused = Malloc(64u);
+    ASSERT_EQ(reused, first_addr);
+    (void)Malloc(DS_MAX_ALLOCATION_SIZE);
+    ASSERT_EQ(ds_release_to_mark(&buf_, mark), ERROR_DS_OK);
+
+    EXPECT_EQ(UsedBytes(), 128u);
+    EXPECT_EQ(ds_free(&buf_, &reused), ERROR_DS_OK);
+}
+
+TEST_F(Mark_Tests, Invalid_Marks_Are_Rejected)
+{
+    dynostatic_buffer_t uninitialized = { 0 };
+    ds_mark_t mark = 0u;
+
+    EXPECT_EQ(ds_get_mark(NULL, &mark), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_get_mark(&buf_, NULL), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_get_mark(&uninitialized, &mark), ERROR_DS_NO_INIT);
+    EXPECT_EQ(ds_release_to_mark(NULL, 0u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_release_to_mark(&uninitialized, 0u), ERROR_DS_NO_INIT);
+
+    void *const p = Malloc(64u);
+    EXPECT_EQ(ds_release_to_mark(&buf_, 1u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_release_to_mark(&buf_, DS_BUFFER_MEMORY_SIZE + DS_ALIGNMENT), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_release_to_mark(&buf_, SIZE_MAX), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_release_to_mark(&buf_, DS_BUFFER_MEMORY_SIZE), ERROR_DS_OK);
+    EXPECT_EQ(UsedBytes(), 64u);
+    EXPECT_NE(p, nullptr);
+}
+
+TEST_F(Mark_Tests, Reset_Releases_Everything)
+{
+    uint8_t *p = nullptr;
+    for (size_t i = 0u; i < DS_MAX_ALLOCATION_COUNT; i++) {
+        p = static_cast<uint8_t *>(Malloc(16u));
+    }
+    std::memset(p, 0xC3, 16u);
+
+    ASSERT_EQ(ds_reset(&buf_), ERROR_DS_OK);
+    ExpectEmpty();
+#if DS_ZERO_ON_FREE == 1u
+    EXPECT_EQ(p[0], 0u);
+#else
+    EXPECT_EQ(p[0], 0xC3u); /* the arena is left as it was */
+#endif
+
+    void *stale = p;
+    EXPECT_EQ(ds_free(&buf_, &stale), ERROR_DS_ALLOCATOR_NOT_FOUND);
+    for (size_t i = 0u; i < DS_BUFFER_MEMORY_SIZE / DS_MAX_ALLOCATION_SIZE; i++) {
+        EXPECT_NE(Malloc(DS_MAX_ALLOCATION_SIZE), nullptr);
+    }
+}
+
+TEST_F(Mark_Tests, Reset_Rejects_Bad_Arguments)
+{
+    dynostatic_buffer_t uninitialized = { 0 };
+
+    EXPECT_EQ(ds_reset(NULL), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_reset(&uninitialized), ERROR_DS_NO_INIT);
+    EXPECT_EQ(ds_reset(&buf_), ERROR_DS_OK); /* an empty instance is fine */
+}
+
+#if DS_HANDLES == 1u
+TEST_F(Mark_Tests, Handles_Go_Stale_On_Reset_And_Release)
+{
+    ds_handle_t before = DS_HANDLE_NONE;
+    ASSERT_EQ(ds_halloc(&buf_, &before, 32u), ERROR_DS_OK);
+    ASSERT_EQ(ds_reset(&buf_), ERROR_DS_OK);
+
+    ds_handle_t after = DS_HANDLE_NONE;
+    ASSERT_EQ(ds_halloc(&buf_, &after, 32u), ERROR_DS_OK);
+    EXPECT_NE(after, before);
+
+    void *p = nullptr;
+    EXPECT_EQ(ds_hlock(&buf_, before, &p), ERROR_DS_STALE_HANDLE);
+    ASSERT_EQ(ds_release_to_mark(&buf_, 0u), ERROR_DS_OK);
+    EXPECT_EQ(ds_hlock(&buf_, after, &p), ERROR_DS_STALE_HANDLE);
+    ExpectEmpty();
+}
+#endif
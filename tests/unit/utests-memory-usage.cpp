@@ -32,3 +32,64 @@ TEST_F(MemoryUsage_Tests, Null_Output)
 {
     ASSERT_EQ(ds_get_memory_usage(&buf_, NULL), ERROR_DS_INVALID_ARG);
 }
+
+TEST_F(MemoryUsage_Tests, Parked_Blocks_Are_Not_Counted)
+{
+    void *a = NULL;
+    void *b = NULL;
+    void *c = NULL;
+    uint8_t usage = 0xFF;
+
+    ASSERT_EQ(ds_malloc(&buf_, &a, 100), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, &b, 200), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, &c, 50), ERROR_DS_OK);
+
+    // b is not trailing, so it is parked rather than reclaimed.
+    ASSERT_EQ(ds_free(&buf_, &b), ERROR_DS_OK);
+
+    ASSERT_EQ(ds_get_memory_usage(&buf_, &usage), ERROR_DS_OK);
+    EXPECT_EQ(usage, dstest::ExpectedUsage(dstest::AlignUp(100) + dstest::AlignUp(50)));
+}
+
+TEST(MemoryUsage_NoFixture_Tests, Bytes_Bad_Input_Params)
+{
+    dynostatic_buffer_t ds_buffer = { 0 };
+    size_t bytes = 0u;
+
+    ASSERT_EQ(ds_get_memory_usage_bytes(NULL, &bytes), ERROR_DS_INVALID_ARG);
+    ASSERT_EQ(ds_get_memory_usage_bytes(&ds_buffer, NULL), ERROR_DS_INVALID_ARG);
+    ASSERT_EQ(ds_get_memory_usage_bytes(&ds_buffer, &bytes), ERROR_DS_NO_INIT);
+}
+
+TEST_F(MemoryUsage_Tests, Bytes_Track_Malloc_Realloc_Free)
+{
+    void *a = NULL;
+    void *b = NULL;
+    size_t bytes = 0xFFu;
+
+    ASSERT_EQ(ds_get_memory_usage_bytes(&buf_, &bytes), ERROR_DS_OK);
+    EXPECT_EQ(bytes, 0u);
+
+    ASSERT_EQ(ds_malloc(&buf_, &a, 100), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, &b, 30), ERROR_DS_OK);
+    ASSERT_EQ(ds_get_memory_usage_bytes(&buf_, &bytes), ERROR_DS_OK);
+    EXPECT_EQ(bytes, dstest::AlignUp(100) + dstest::AlignUp(30));
+
+    // Shrinking the interior block hands its tail back.
+    ASSERT_EQ(ds_realloc(&buf_, &a, 40), ERROR_DS_OK);
+    ASSERT_EQ(ds_get_memory_usage_bytes(&buf_, &bytes), ERROR_DS_OK);
+    EXPECT_EQ(bytes, dstest::AlignUp(40) + dstest::AlignUp(30));
+
+    // Growing the trailing block in place.
+    ASSERT_EQ(ds_realloc(&buf_, &b, 90), ERROR_DS_OK);
+    ASSERT_EQ(ds_get_memory_usage_bytes(&buf_, &bytes), ERROR_DS_OK);
+    EXPECT_EQ(bytes, dstest::AlignUp(40) + dstest::AlignUp(90));
+
+    ASSERT_EQ(ds_free(&buf_, &a), ERROR_DS_OK);
+    ASSERT_EQ(ds_get_memory_usage_bytes(&buf_, &bytes), ERROR_DS_OK);
+    EXPECT_EQ(bytes, dstest::AlignUp(90));
+
+    ASSERT_EQ(ds_free(&buf_, &b), ERROR_DS_OK);
+    ASSERT_EQ(ds_get_memory_usage_bytes(&buf_, &bytes), ERROR_DS_OK);
+    EXPECT_EQ(bytes, 0u);
+}
@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <random>
+#include <tuple>
 #include <vector>
 #include <numeric>
 
@@ -28,7 +29,7 @@ constexpr unsigned kMallocBiasPercent = 55u; /* malloc vs free mix while blocks
 } // namespace
 
 class Monte_Carlo_Tests : public DsBufferTest,
-                          public ::testing::WithParamInterface<uint32_t> {
+                          public ::testing::WithParamInterface<std::tuple<ds_fit_policy_t, uint32_t>> {
   protected:
     struct LiveBlock {
         uint8_t *ptr;
@@ -55,9 +56,10 @@ class Monte_Carlo_Tests : public DsBufferTest,
 
         uint8_t usage = 0xFFu;
         ASSERT_EQ(ds_get_memory_usage(&buf_, &usage), ERROR_DS_OK);
-        /* Reused blocks RETAIN their original capacity (see ds_allocator_t), so
-         * real usage may exceed the sum of aligned requests — the model can
-         * assert a LOWER BOUND per-op; exact equality holds only at drain. */
+        /* A reused block keeps its whole capacity when no spare record is
+         * left to split it (see ds_allocator_t), so real usage may exceed the
+         * sum of aligned requests — the model can assert a LOWER BOUND per-op;
+         * exact equality holds only at drain. */
         ASSERT_GE(static_cast<unsigned>(usage),
                   static_cast<unsigned>(ExpectedUsage(total_aligned)))
             << "usage below the aligned-requests floor at op " << op << " (seed " << seed << ")";
@@ -102,7 +104,8 @@ class Monte_Carlo_Tests : public DsBufferTest,
 
 TEST_P(Monte_Carlo_Tests, Random_Alloc_Free_Storm)
 {
-    const uint32_t seed = GetParam();
+    const auto [policy, seed] = GetParam();
+    ASSERT_EQ(ds_set_fit_policy(&buf_, policy), ERROR_DS_OK);
     std::mt19937 rng(seed);
     std::uniform_int_distribution<size_t> size_dist(1u, DS_MAX_ALLOCATION_SIZE);
 
@@ -192,8 +195,11 @@ TEST_P(Monte_Carlo_Tests, Random_Alloc_Free_Storm)
     }
 }
 
-/* Fixed seeds: deterministic in CI, wide enough to vary the interleavings.
+/* Fixed seeds under every placement policy: deterministic in CI, wide
+ * enough to vary the interleavings.
  * To explore a failure locally, add its seed to this list. */
 INSTANTIATE_TEST_SUITE_P(Seeds, Monte_Carlo_Tests,
-                         ::testing::Values(0x5EED0001u, 0x5EED0002u, 0x5EED0003u,
-                                           0xC0FFEE42u));
+                         ::testing::Combine(::testing::Values(DS_FIT_SEGREGATED, DS_FIT_FIRST, DS_FIT_BEST,
+                                                              DS_FIT_NEXT, DS_FIT_ROUNDED),
+                                            ::testing::Values(0x5EED0001u, 0x5EED0002u, 0x5EED0003u,
+                                                              0xC0FFEE42u)));
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <random>
+#include <tuple>
 #include <vector>
 #include <numeric>
 
@@ -30,13 +31,13 @@ constexpr size_t kOperations = 1000u;
 } // namespace
 
 class Monte_Carlo_Realloc_Tests : public DsBufferTest,
-                                  public ::testing::WithParamInterface<uint32_t> {
+                                  public ::testing::WithParamInterface<std::tuple<ds_fit_policy_t, uint32_t>> {
   protected:
     struct LiveBlock {
         uint8_t *ptr;
         size_t requested; /* current requested size (pattern spans this) */
         size_t cap_lower; /* derivable lower bound on physical capacity:
-                              max(AlignUp(r)) over the block's request history */
+                              AlignUp(r) of the latest request */
         uint8_t pattern;
     };
 
@@ -107,7 +108,8 @@ class Monte_Carlo_Realloc_Tests : public DsBufferTest,
 
 TEST_P(Monte_Carlo_Realloc_Tests, Random_Malloc_Free_Realloc_Storm)
 {
-    const uint32_t seed = GetParam();
+    const auto [policy, seed] = GetParam();
+    ASSERT_EQ(ds_set_fit_policy(&buf_, policy), ERROR_DS_OK);
     std::mt19937 rng(seed);
     std::uniform_int_distribution<size_t> size_dist(1u, DS_MAX_ALLOCATION_SIZE);
 
@@ -197,12 +199,9 @@ TEST_P(Monte_Carlo_Realloc_Tests, Random_Malloc_Free_Realloc_Storm)
                         << " (seed " << seed << ")";
                 }
 
-                /* Model update — the cap_lower rule keyed on observed movement:
-                 * same pointer -> capacity retained: max(old, AlignUp(new));
-                 * new pointer  -> fresh history:     AlignUp(new). */
-                b.cap_lower = (np == old_ptr)
-                                ? std::max(b.cap_lower, AlignUp(new_req))
-                                : AlignUp(new_req);
+                /* Model update: a shrink may hand its surplus back and a move
+                 * starts afresh, so only the new request is a safe floor. */
+                b.cap_lower = AlignUp(new_req);
                 b.ptr = np;
                 b.requested = new_req;
                 b.pattern = NextPattern();
@@ -255,5 +254,7 @@ TEST_P(Monte_Carlo_Realloc_Tests, Random_Malloc_Free_Realloc_Storm)
 }
 
 INSTANTIATE_TEST_SUITE_P(Seeds, Monte_Carlo_Realloc_Tests,
-                         ::testing::Values(0x5EED1001u, 0x5EED1002u, 0x5EED1003u,
-                                           0xBEEF7777u));
+                         ::testing::Combine(::testing::Values(DS_FIT_SEGREGATED, DS_FIT_FIRST, DS_FIT_BEST,
+                                                              DS_FIT_NEXT, DS_FIT_ROUNDED),
+                                            ::testing::Values(0x5EED1001u, 0x5EED1002u, 0x5EED1003u,
+                                                              0xBEEF7777u)));
@@ -0,0 +1,251 @@
+/**
+ * @file utests-pool.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Unit tests for fixed-size slot pools (ds_pool_*).
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "utests-common.hpp"
+
+#include <set>
+
+using dstest::AlignUp;
+using dstest::DsBufferTest;
+
+class Pool_Tests : public DsBufferTest {
+  protected:
+    void TearDown() override
+    {
+        (void)ds_pool_destroy(&pool_);
+        DsBufferTest::TearDown();
+    }
+
+    void *Take()
+    {
+        void *p = nullptr;
+        EXPECT_EQ(ds_pool_alloc(&pool_, &p), ERROR_DS_OK);
+        return p;
+    }
+
+    ds_pool_t pool_{};
+};
+
+TEST_F(Pool_Tests, Create_Rejects_Bad_Arguments)
+{
+    dynostatic_buffer_t uninitialized = { 0 };
+
+    EXPECT_EQ(ds_pool_create(NULL, &pool_, 8u, 4u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_pool_create(&buf_, NULL, 8u, 4u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_pool_create(&buf_, &pool_, 0u, 4u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_pool_create(&buf_, &pool_, 8u, 0u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_pool_create(&uninitialized, &pool_, 8u, 4u), ERROR_DS_NO_INIT);
+    EXPECT_EQ(ds_pool_create(&buf_, &pool_, DS_MAX_ALLOCATION_SIZE + 1u, 1u), ERROR_DS_TOO_BIG_CHUNK);
+    EXPECT_EQ(ds_pool_create(&buf_, &pool_, 8u, DS_MAX_ALLOCATION_SIZE), ERROR_DS_TOO_BIG_CHUNK);
+    EXPECT_EQ(ds_pool_create(&buf_, &pool_, SIZE_MAX, SIZE_MAX), ERROR_DS_TOO_BIG_CHUNK);
+
+    ASSERT_EQ(ds_pool_create(&buf_, &pool_, 8u, 4u), ERROR_DS_OK);
+    EXPECT_EQ(ds_pool_create(&buf_, &pool_, 8u, 4u), ERROR_DS_ALREADY_INIT);
+}
+
+TEST_F(Pool_Tests, Whole_Pool_Costs_One_Record)
+{
+    const size_t before = FreeAllocators();
+    const size_t slots = 3u * DS_MAX_ALLOCATION_COUNT;
+
+    ASSERT_EQ(ds_pool_create(&buf_, &pool_, 1u, slots), ERROR_DS_OK);
+    EXPECT_EQ(pool_.slot_size, AlignUp(1u));
+
+    std::set<void *> seen;
+    for (size_t i = 0u; i < slots; i++) {
+        void *const p = Take();
+        ASSERT_NE(p, nullptr);
+        EXPECT_TRUE(dstest::IsAligned(p));
+        EXPECT_TRUE(seen.insert(p).second);
+    }
+    EXPECT_EQ(FreeAllocators(), before - 1u);
+    EXPECT_EQ(pool_.free_count, 0u);
+
+    void *p = nullptr;
+    EXPECT_EQ(ds_pool_alloc(&pool_, &p), ERROR_DS_NO_MEMORY);
+    EXPECT_EQ(p, nullptr);
+}
+
+TEST_F(Pool_Tests, Released_Slots_Are_Reused_Last_In_First_Out)
+{
+    ASSERT_EQ(ds_pool_create(&buf_, &pool_, 12u, 4u), ERROR_DS_OK);
+
+    void *a = Take();
+    void *b = Take();
+    void *const a_addr = a;
+    void *const b_addr = b;
+    std::memset(a, 0x77, pool_.slot_size);
+
+    ASSERT_EQ(ds_pool_free(&pool_, &a), ERROR_DS_OK);
+    EXPECT_EQ(a, nullptr);
+    ASSERT_EQ(ds_pool_free(&pool_, &b), ERROR_DS_OK);
+    EXPECT_EQ(pool_.free_count, 4u);
+
+    EXPECT_EQ(Take(), b_addr);
+    EXPECT_EQ(Take(), a_addr);
+    EXPECT_NE(Take(), nullptr);
+    EXPECT_NE(Take(), nullptr);
+    EXPECT_EQ(pool_.free_count, 0u);
+}
+
+TEST_F(Pool_Tests, Free_Rejects_Foreign_And_Interior_Pointers)
+{
+    ASSERT_EQ(ds_pool_create(&buf_, &pool_, 16u, 4u), ERROR_DS_OK);
+    char *const slot = static_cast<char *>(Take());
+    void *const outside = Malloc(16u);
+
+    void *p = nullptr;
+    EXPECT_EQ(ds_pool_free(&pool_, &p), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_pool_free(&pool_, NULL), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_pool_free(NULL, &p), ERROR_DS_INVALID_ARG);
+
+    p = outside;
+    EXPECT_EQ(ds_pool_free(&pool_, &p), ERROR_DS_MEMORY_OUT_OF_DS);
+    p = slot + DS_ALIGNMENT;
+    EXPECT_EQ(ds_pool_free(&pool_, &p), ERROR_DS_ALLOCATOR_NOT_FOUND);
+    p = slot + pool_.slot_size; /* a slot never handed out */
+    EXPECT_EQ(ds_pool_free(&pool_, &p), ERROR_DS_ALLOCATOR_NOT_FOUND);
+    EXPECT_EQ(p, slot + pool_.slot_size);
+    EXPECT_EQ(pool_.free_count, 3u);
+}
+
+TEST_F(Pool_Tests, Uncreated_Pool_Reports_No_Init)
+{
+    void *p = nullptr;
+
+    EXPECT_EQ(ds_pool_alloc(&pool_, &p), ERROR_DS_NO_INIT);
+    EXPECT_EQ(ds_pool_alloc(&pool_, NULL), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_pool_alloc(NULL, &p), ERROR_DS_INVALID_ARG);
+    p = &pool_;
+    EXPECT_EQ(ds_pool_free(&pool_, &p), ERROR_DS_NO_INIT);
+    EXPECT_EQ(ds_pool_destroy(&pool_), ERROR_DS_NO_INIT);
+    EXPECT_EQ(ds_pool_destroy(NULL), ERROR_DS_INVALID_ARG);
+}
+
+TEST_F(Pool_Tests, Destroy_Returns_The_Block_In_One_Free)
+{
+    ASSERT_EQ(ds_pool_create(&buf_, &pool_, 8u, 16u), ERROR_DS_OK);
+    for (size_t i = 0u; i < 5u; i++) {
+        (void)Take();
+    }
+
+    ASSERT_EQ(ds_pool_destroy(&pool_), ERROR_DS_OK);
+    EXPECT_EQ(pool_.p_ds_buffer, nullptr);
+
+    EXPECT_EQ(UsedBytes(), 0u);
+    EXPECT_EQ(FreeAllocators(), static_cast<size_t>(DS_MAX_ALLOCATION_COUNT));
+
+    /* A destroyed pool can be created again. */
+    EXPECT_EQ(ds_pool_create(&buf_, &pool_, 8u, 16u), ERROR_DS_OK);
+}
+
+TEST_F(Pool_Tests, Destroy_After_Deinit_Resets_The_Pool)
+{
+    ASSERT_EQ(ds_pool_create(&buf_, &pool_, 8u, 4u), ERROR_DS_OK);
+    ASSERT_EQ(ds_deinit_allocation(&buf_), ERROR_DS_OK);
+
+    EXPECT_EQ(ds_pool_destroy(&pool_), ERROR_DS_NO_INIT);
+    EXPECT_EQ(pool_.p_ds_buffer, nullptr);
+}
+
+TEST_F(Pool_Tests, Free_Catches_Double_Releases)
+{
+    ASSERT_EQ(ds_pool_create(&buf_, &pool_, 8u, 4u), ERROR_DS_OK);
+    void *a = Take();
+    void *b = Take();
+    void *const a_addr = a;
+    void *const b_addr = b;
+
+    ASSERT_EQ(ds_pool_free(&pool_, &a), ERROR_DS_OK);
+    a = a_addr;
+    EXPECT_EQ(ds_pool_free(&pool_, &a), ERROR_DS_ALLOCATOR_NOT_FOUND); /* released last */
+    EXPECT_EQ(a, a_addr);
+
+    ASSERT_EQ(ds_pool_free(&pool_, &b), ERROR_DS_OK);
+    a = a_addr;
+    EXPECT_EQ(ds_pool_free(&pool_, &a), ERROR_DS_ALLOCATOR_NOT_FOUND); /* nothing in use */
+    EXPECT_EQ(pool_.free_count, 4u);
+
+    /* Each slot is still handed out once. */
+    std::set<void *> seen;
+    for (size_t i = 0u; i < 4u; i++) {
+        EXPECT_TRUE(seen.insert(Take()).second);
+    }
+    EXPECT_EQ(seen.count(a_addr), 1u);
+    EXPECT_EQ(seen.count(b_addr), 1u);
+}
+
+TEST_F(Pool_Tests, Free_Catches_A_Double_Release_Below_The_Head)
+{
+    ASSERT_EQ(ds_pool_create(&buf_, &pool_, 8u, 4u), ERROR_DS_OK);
+    void *a = Take();
+    void *b = Take();
+    void *const a_addr = a;
+
+    ASSERT_EQ(ds_pool_free(&pool_, &a), ERROR_DS_OK);
+    ASSERT_EQ(ds_pool_free(&pool_, &b), ERROR_DS_OK); /* the list is now b -> a */
+    a = a_addr;
+    EXPECT_EQ(ds_pool_free(&pool_, &a), ERROR_DS_ALLOCATOR_NOT_FOUND);
+    EXPECT_EQ(a, a_addr);
+    EXPECT_EQ(pool_.free_count, 4u);
+
+    std::set<void *> seen;
+    for (size_t i = 0u; i < 4u; i++) {
+        EXPECT_TRUE(seen.insert(Take()).second);
+    }
+    void *p = nullptr;
+    EXPECT_EQ(ds_pool_alloc(&pool_, &p), ERROR_DS_NO_MEMORY);
+}
+
+TEST_F(Pool_Tests, In_Use_Map_Spans_Several_Words)
+{
+    const size_t slots = 40u;
+    ASSERT_EQ(ds_pool_create(&buf_, &pool_, 4u, slots), ERROR_DS_OK);
+#if DS_ENGINE != DS_ENGINE_BUDDY
+    EXPECT_EQ(UsedBytes(), (slots * pool_.slot_size) + (2u * sizeof(uint32_t))); /* two map words after the slots */
+#endif
+
+    void *taken[40] = { nullptr };
+    for (size_t i = 0u; i < slots; i++) {
+        taken[i] = Take();
+    }
+    for (size_t i = 0u; i < slots; i += 2u) {
+        ASSERT_EQ(ds_pool_free(&pool_, &taken[i]), ERROR_DS_OK);
+    }
+    for (size_t i = 0u; i < slots; i++) {
+        const bool released = (0u == (i % 2u));
+        void *p = released ? static_cast<void *>(&pool_.p_slots[i * pool_.slot_size]) : taken[i];
+        const ds_err_code_t expected = released ? ERROR_DS_ALLOCATOR_NOT_FOUND : ERROR_DS_OK;
+        EXPECT_EQ(ds_pool_free(&pool_, &p), expected) << "slot " << i;
+    }
+    EXPECT_EQ(pool_.free_count, slots);
+}
+
+TEST_F(Pool_Tests, Destroy_After_Reset_Frees_Nothing)
+{
+    ASSERT_EQ(ds_pool_create(&buf_, &pool_, 8u, 4u), ERROR_DS_OK);
+    ASSERT_EQ(ds_reset(&buf_), ERROR_DS_OK);
+
+    EXPECT_EQ(ds_pool_destroy(&pool_), ERROR_DS_ALLOCATOR_NOT_FOUND);
+    EXPECT_EQ(pool_.p_ds_buffer, nullptr);
+}
+
+TEST_F(Pool_Tests, Destroy_After_Free_Of_The_Block_Frees_Nothing)
+{
+    ASSERT_EQ(ds_pool_create(&buf_, &pool_, 16u, 8u), ERROR_DS_OK);
+    void *const keep = Malloc(DS_ALIGNMENT);
+    void *block = pool_.p_slots;
+    ASSERT_EQ(ds_free(&buf_, &block), ERROR_DS_OK);
+
+    EXPECT_EQ(ds_pool_destroy(&pool_), ERROR_DS_ALLOCATOR_NOT_FOUND);
+    EXPECT_EQ(pool_.p_ds_buffer, nullptr);
+    EXPECT_EQ(UsedBytes(), static_cast<size_t>(DS_ALIGNMENT)); /* the other block is untouched */
+    void *p = keep;
+    EXPECT_EQ(ds_free(&buf_, &p), ERROR_DS_OK);
+}
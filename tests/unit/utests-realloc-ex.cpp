@@ -0,0 +1,153 @@
+/**
+ * @file utests-realloc-ex.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Unit tests for capacity-aware resizing (ds_usable_size(),
+ *        ds_realloc_ex()).
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "utests-common.hpp"
+
+using dstest::DsBufferTest;
+
+class Realloc_Ex_Tests : public DsBufferTest {
+  protected:
+    size_t Usable(const void *p)
+    {
+        size_t usable = 0u;
+        EXPECT_EQ(ds_usable_size(&buf_, p, &usable), ERROR_DS_OK);
+        return usable;
+    }
+};
+
+TEST_F(Realloc_Ex_Tests, Usable_Size_Reports_The_Capacity)
+{
+    void *p = Malloc(5u);
+#if DS_ENGINE == DS_ENGINE_BUDDY
+    EXPECT_EQ(Usable(p), 8u); /* the smallest buddy */
+#else
+    EXPECT_EQ(Usable(p), dstest::AlignUp(5u));
+#endif
+    EXPECT_EQ(Usable(Malloc(DS_MAX_ALLOCATION_SIZE)), static_cast<size_t>(DS_MAX_ALLOCATION_SIZE));
+
+    size_t usable = 0u;
+    EXPECT_EQ(ds_usable_size(&buf_, static_cast<uint8_t *>(p) + DS_ALIGNMENT, &usable), ERROR_DS_ALLOCATOR_NOT_FOUND);
+    EXPECT_EQ(ds_usable_size(&buf_, &usable, &usable), ERROR_DS_MEMORY_OUT_OF_DS);
+    EXPECT_EQ(ds_usable_size(&buf_, NULL, &usable), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_usable_size(&buf_, p, NULL), ERROR_DS_INVALID_ARG);
+}
+
+TEST_F(Realloc_Ex_Tests, Room_Already_Changes_Nothing)
+{
+    void *p = Malloc(5u);
+    void *const before = p;
+    const size_t usable = Usable(p);
+    size_t capacity = 0u;
+
+    ASSERT_EQ(ds_realloc_ex(&buf_, &p, usable, 256u, &capacity), ERROR_DS_OK);
+    EXPECT_EQ(p, before);
+    EXPECT_EQ(capacity, usable);
+}
+
+TEST_F(Realloc_Ex_Tests, Grows_In_Place_To_The_Preferred_Size)
+{
+    void *p = Malloc(16u);
+    void *const before = p;
+    size_t capacity = 0u;
+
+    ASSERT_EQ(ds_realloc_ex(&buf_, &p, 32u, 128u, &capacity), ERROR_DS_OK);
+    EXPECT_EQ(p, before);
+    EXPECT_EQ(capacity, 128u);
+    EXPECT_EQ(Usable(p), 128u);
+}
+
+#if (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
+TEST_F(Realloc_Ex_Tests, Trailing_Block_Takes_What_The_Bump_Space_Has)
+{
+    (void)Malloc(512u);
+    (void)Malloc(256u);
+    void *p = Malloc(64u);
+    void *const before = p;
+    size_t capacity = 0u;
+
+    ASSERT_EQ(ds_realloc_ex(&buf_, &p, 100u, 512u, &capacity), ERROR_DS_OK);
+    EXPECT_EQ(p, before);
+    EXPECT_EQ(capacity, DS_BUFFER_MEMORY_SIZE - 768u); /* all of it, short of the hint */
+}
+#endif
+
+TEST_F(Realloc_Ex_Tests, Moves_To_The_Preferred_Size)
+{
+    uint8_t *p = static_cast<uint8_t *>(Malloc(16u));
+    (void)Malloc(16u); /* pins p in place */
+    for (size_t i = 0u; i < 16u; i++) {
+        p[i] = static_cast<uint8_t>(i + 1u);
+    }
+    void *moved = p;
+    size_t capacity = 0u;
+
+    ASSERT_EQ(ds_realloc_ex(&buf_, &moved, 32u, 128u, &capacity), ERROR_DS_OK);
+    EXPECT_NE(moved, static_cast<void *>(p));
+    EXPECT_EQ(capacity, 128u);
+    for (size_t i = 0u; i < 16u; i++) {
+        EXPECT_EQ(static_cast<uint8_t *>(moved)[i], i + 1u);
+    }
+}
+
+TEST_F(Realloc_Ex_Tests, Falls_Back_To_The_Minimum)
+{
+    (void)Malloc(512u);
+    (void)Malloc(256u);
+    (void)Malloc(128u);
+    (void)Malloc(64u); /* 64 bytes left */
+
+    void *p = nullptr;
+    size_t capacity = 0u;
+    ASSERT_EQ(ds_realloc_ex(&buf_, &p, 32u, 256u, &capacity), ERROR_DS_OK);
+    EXPECT_GE(capacity, 32u);
+    EXPECT_LE(capacity, 64u);
+
+    void *q = nullptr;
+    EXPECT_EQ(ds_realloc_ex(&buf_, &q, 128u, 256u, &capacity), ERROR_DS_NO_MEMORY);
+    EXPECT_EQ(q, nullptr);
+}
+
+TEST_F(Realloc_Ex_Tests, Preferred_Size_Is_Only_A_Hint)
+{
+    void *p = nullptr;
+    size_t capacity = 0u;
+
+    ASSERT_EQ(ds_realloc_ex(&buf_, &p, 8u, SIZE_MAX, &capacity), ERROR_DS_OK);
+    EXPECT_EQ(capacity, static_cast<size_t>(DS_MAX_ALLOCATION_SIZE));
+}
+
+TEST_F(Realloc_Ex_Tests, Bad_Arguments_Are_Rejected)
+{
+    dynostatic_buffer_t uninitialized = { 0 };
+    void *p = Malloc(8u);
+    void *const before = p;
+    size_t capacity = 0u;
+
+    EXPECT_EQ(ds_realloc_ex(NULL, &p, 8u, 8u, &capacity), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_realloc_ex(&buf_, NULL, 8u, 8u, &capacity), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_realloc_ex(&buf_, &p, 8u, 8u, NULL), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_realloc_ex(&buf_, &p, 0u, 8u, &capacity), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_realloc_ex(&buf_, &p, 16u, 8u, &capacity), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_realloc_ex(&uninitialized, &p, 8u, 8u, &capacity), ERROR_DS_NO_INIT);
+    EXPECT_EQ(ds_realloc_ex(&buf_, &p, DS_MAX_ALLOCATION_SIZE + 1u, SIZE_MAX, &capacity), ERROR_DS_TOO_BIG_CHUNK);
+    EXPECT_EQ(p, before);
+
+    void *interior = static_cast<uint8_t *>(p) + DS_ALIGNMENT;
+    EXPECT_EQ(ds_realloc_ex(&buf_, &interior, 64u, 64u, &capacity), ERROR_DS_ALLOCATOR_NOT_FOUND);
+
+#if DS_HANDLES == 1u
+    ds_handle_t handle = DS_HANDLE_NONE;
+    void *locked = nullptr;
+    ASSERT_EQ(ds_halloc(&buf_, &handle, 32u), ERROR_DS_OK);
+    ASSERT_EQ(ds_hlock(&buf_, handle, &locked), ERROR_DS_OK);
+    EXPECT_EQ(ds_realloc_ex(&buf_, &locked, 64u, 64u, &capacity), ERROR_DS_INVALID_ARG);
+    ASSERT_EQ(ds_hunlock(&buf_, handle), ERROR_DS_OK);
+#endif
+}
@@ -76,7 +76,53 @@ TEST_F(Realloc_Tests, Shrink_Keeps_Pointer)
     ASSERT_EQ(p, before); // shrink in place
 
     ASSERT_EQ(ds_get_memory_usage(&buf_, &usage), ERROR_DS_OK);
-    ASSERT_EQ(usage, dstest::ExpectedUsage(dstest::AlignUp(64u)));
+    ASSERT_EQ(usage, dstest::ExpectedUsage(dstest::AlignUp(16u))); // surplus handed back
+}
+
+TEST_F(Realloc_Tests, Shrink_Of_Interior_Block_Parks_Surplus)
+{
+    char *p = NULL;
+    char *guard = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), 64), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&guard), 16), ERROR_DS_OK);
+
+    ASSERT_EQ(ds_realloc(&buf_, reinterpret_cast<void **>(&p), 16), ERROR_DS_OK);
+
+    // The returned tail is reusable in place, ahead of any bump space.
+    char *q = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&q), 48), ERROR_DS_OK);
+    ASSERT_EQ(q, p + dstest::AlignUp(16u));
+}
+
+TEST_F(Realloc_Tests, Grow_Into_Parked_Neighbour_Keeps_Pointer)
+{
+    char *p = NULL;
+    char *neighbour = NULL;
+    char *guard = NULL;
+
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), 16), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&neighbour), 64), ERROR_DS_OK);
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&guard), 16), ERROR_DS_OK);
+    ASSERT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&neighbour)), ERROR_DS_OK);
+
+    std::memset(p, 0x5A, 16);
+    char *const before = p;
+
+    // Takes part of the parked neighbour; the rest stays parked behind it.
+    ASSERT_EQ(ds_realloc(&buf_, reinterpret_cast<void **>(&p), 48), ERROR_DS_OK);
+    ASSERT_EQ(p, before);
+    for (size_t i = 0; i < 16; i++) {
+        ASSERT_EQ(p[i], 0x5A) << "byte " << i << " lost";
+    }
+
+    char *rest = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&rest), 32), ERROR_DS_OK);
+    ASSERT_EQ(rest, p + dstest::AlignUp(48u));
+
+    uint8_t usage = 0xFF;
+    ASSERT_EQ(ds_get_memory_usage(&buf_, &usage), ERROR_DS_OK);
+    ASSERT_EQ(usage, dstest::ExpectedUsage(dstest::AlignUp(48u) + dstest::AlignUp(32u) + dstest::AlignUp(16u)));
 }
 
 TEST_F(Realloc_Tests, Grow_Preserves_Contents)
@@ -0,0 +1,183 @@
+/**
+ * @file utests-requested.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Unit tests for requested-size tracking (DS_TRACK_REQUESTED:
+ *        ds_requested_size(), ds_get_requested_bytes()).
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "utests-common.hpp"
+
+#if DS_TRACK_REQUESTED == 1u
+
+using dstest::DsBufferTest;
+
+class Requested_Tests : public DsBufferTest {
+  protected:
+    size_t Requested(const void *p)
+    {
+        size_t requested = SIZE_MAX;
+        EXPECT_EQ(ds_requested_size(&buf_, p, &requested), ERROR_DS_OK);
+        return requested;
+    }
+
+    size_t RequestedBytes()
+    {
+        size_t requested = SIZE_MAX;
+        EXPECT_EQ(ds_get_requested_bytes(&buf_, &requested), ERROR_DS_OK);
+        return requested;
+    }
+};
+
+TEST_F(Requested_Tests, Totals_Follow_Allocation_And_Free)
+{
+    void *a = Malloc(5u);
+    void *b = Malloc(30u);
+    EXPECT_EQ(Requested(a), 5u);
+    EXPECT_EQ(Requested(b), 30u);
+    EXPECT_EQ(RequestedBytes(), 35u);
+    EXPECT_GE(UsedBytes(), RequestedBytes()); /* the difference is internal fragmentation */
+
+    ASSERT_EQ(ds_free(&buf_, &a), ERROR_DS_OK);
+    EXPECT_EQ(RequestedBytes(), 30u);
+    ASSERT_EQ(ds_free(&buf_, &b), ERROR_DS_OK);
+    EXPECT_EQ(RequestedBytes(), 0u);
+}
+
+TEST_F(Requested_Tests, Difference_Is_The_Internal_Fragmentation)
+{
+    void *big = Malloc(256u);
+    (void)Malloc(16u); /* keeps the freed block parked */
+    ASSERT_EQ(ds_free(&buf_, &big), ERROR_DS_OK);
+
+    void *small = Malloc(200u);
+    EXPECT_EQ(Requested(small), 200u);
+    const size_t waste = UsedBytes() - RequestedBytes();
+    size_t usable = 0u;
+    ASSERT_EQ(ds_usable_size(&buf_, small, &usable), ERROR_DS_OK);
+    EXPECT_EQ(waste, usable - 200u); /* the 16-byte block wastes nothing */
+    EXPECT_EQ(UsedBytes(), RequestedBytes()); /* the reported capacity is claimed */
+}
+
+TEST_F(Requested_Tests, Moving_Realloc_Keeps_The_Reported_Capacity)
+{
+    uint8_t *p = static_cast<uint8_t *>(Malloc(61u)); /* rounded up to the alignment */
+    (void)Malloc(16u);                                  /* pins p in place */
+    size_t usable = 0u;
+    ASSERT_EQ(ds_usable_size(&buf_, p, &usable), ERROR_DS_OK);
+    ASSERT_GT(usable, 61u);
+    for (size_t i = 0u; i < usable; i++) {
+        p[i] = static_cast<uint8_t>(i);
+    }
+
+    void *moved = p;
+    ASSERT_EQ(ds_realloc(&buf_, &moved, usable + DS_ALIGNMENT), ERROR_DS_OK);
+    ASSERT_NE(moved, static_cast<void *>(p));
+    const uint8_t *const q = static_cast<const uint8_t *>(moved);
+    for (size_t i = 0u; i < usable; i++) {
+        ASSERT_EQ(q[i], static_cast<uint8_t>(i)) << "byte " << i;
+    }
+}
+
+TEST_F(Requested_Tests, Realloc_Records_The_New_Size)
+{
+    void *p = Malloc(64u);
+    ASSERT_EQ(ds_realloc(&buf_, &p, 10u), ERROR_DS_OK); /* shrink */
+    EXPECT_EQ(Requested(p), 10u);
+    ASSERT_EQ(ds_realloc(&buf_, &p, 100u), ERROR_DS_OK); /* trailing: grows in place */
+    EXPECT_EQ(Requested(p), 100u);
+    EXPECT_EQ(RequestedBytes(), 100u);
+}
+
+TEST_F(Requested_Tests, Moving_Realloc_Copies_The_Live_Bytes)
+{
+    uint8_t *p = static_cast<uint8_t *>(Malloc(64u));
+    (void)Malloc(16u); /* pins p in place */
+    std::memset(p, 0x5A, 64u);
+    void *moved = p;
+    ASSERT_EQ(ds_realloc(&buf_, &moved, 24u), ERROR_DS_OK); /* shrink: requested 24 */
+    ASSERT_EQ(moved, static_cast<void *>(p));
+
+    ASSERT_EQ(ds_realloc(&buf_, &moved, 128u), ERROR_DS_OK);
+    EXPECT_NE(moved, static_cast<void *>(p));
+    EXPECT_EQ(Requested(moved), 128u);
+    for (size_t i = 0u; i < 24u; i++) {
+        EXPECT_EQ(static_cast<uint8_t *>(moved)[i], 0x5Au);
+    }
+}
+
+TEST_F(Requested_Tests, Reserve_And_Commit)
+{
+    void *p = nullptr;
+    ASSERT_EQ(ds_reserve(&buf_, &p, 200u), ERROR_DS_OK);
+    EXPECT_EQ(Requested(p), 200u);
+    ASSERT_EQ(ds_commit(&buf_, &p, 37u), ERROR_DS_OK);
+    EXPECT_EQ(Requested(p), 37u);
+    EXPECT_EQ(RequestedBytes(), 37u);
+}
+
+TEST_F(Requested_Tests, Realloc_Ex_Hands_Out_The_Whole_Capacity)
+{
+    void *p = nullptr;
+    size_t capacity = 0u;
+    ASSERT_EQ(ds_realloc_ex(&buf_, &p, 10u, 48u, &capacity), ERROR_DS_OK);
+    EXPECT_EQ(Requested(p), capacity);
+
+    (void)Malloc(16u); /* forces the next growth to move */
+    std::memset(p, 0x66, capacity);
+    const size_t old_capacity = capacity;
+    ASSERT_EQ(ds_realloc_ex(&buf_, &p, capacity + 1u, 2u * capacity, &capacity), ERROR_DS_OK);
+    EXPECT_EQ(Requested(p), capacity);
+    for (size_t i = 0u; i < old_capacity; i++) {
+        EXPECT_EQ(static_cast<uint8_t *>(p)[i], 0x66u);
+    }
+}
+
+TEST_F(Requested_Tests, Multi_Records_The_Laid_Out_Extent)
+{
+    const ds_multi_desc_t descs[] = {
+        { 12u, DS_ALIGNMENT },
+        { 5u, 1u },
+    };
+    void *parts[2] = { nullptr, nullptr };
+    ASSERT_EQ(ds_malloc_multi(&buf_, parts, descs, 2u), ERROR_DS_OK);
+    EXPECT_EQ(Requested(parts[0]), 17u);
+}
+
+TEST_F(Requested_Tests, Release_To_Mark_And_Reset_Clear_The_Total)
+{
+    ds_mark_t mark = SIZE_MAX;
+    ASSERT_EQ(ds_get_mark(&buf_, &mark), ERROR_DS_OK);
+    (void)Malloc(20u);
+    (void)Malloc(30u);
+    ASSERT_EQ(ds_release_to_mark(&buf_, mark), ERROR_DS_OK);
+    EXPECT_EQ(RequestedBytes(), 0u);
+
+    (void)Malloc(8u);
+    ASSERT_EQ(ds_reset(&buf_), ERROR_DS_OK);
+    EXPECT_EQ(RequestedBytes(), 0u);
+    EXPECT_EQ(Requested(Malloc(3u)), 3u);
+}
+
+TEST_F(Requested_Tests, Bad_Arguments_Are_Rejected)
+{
+    dynostatic_buffer_t uninitialized = { 0 };
+    void *p = Malloc(8u);
+    size_t requested = 0u;
+
+    EXPECT_EQ(ds_requested_size(NULL, p, &requested), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_requested_size(&buf_, NULL, &requested), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_requested_size(&buf_, p, NULL), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_requested_size(&uninitialized, p, &requested), ERROR_DS_NO_INIT);
+    EXPECT_EQ(ds_requested_size(&buf_, static_cast<uint8_t *>(p) + DS_ALIGNMENT, &requested),
+              ERROR_DS_ALLOCATOR_NOT_FOUND);
+    EXPECT_EQ(ds_requested_size(&buf_, &requested, &requested), ERROR_DS_MEMORY_OUT_OF_DS);
+
+    EXPECT_EQ(ds_get_requested_bytes(NULL, &requested), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_get_requested_bytes(&buf_, NULL), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_get_requested_bytes(&uninitialized, &requested), ERROR_DS_NO_INIT);
+}
+
+#endif
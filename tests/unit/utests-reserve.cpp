@@ -0,0 +1,110 @@
+/**
+ * @file utests-reserve.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Unit tests for the reserve/commit pair (ds_reserve(), ds_commit()).
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "utests-common.hpp"
+
+using dstest::DsBufferTest;
+
+class Reserve_Tests : public DsBufferTest {
+  protected:
+    ds_mark_t Mark()
+    {
+        ds_mark_t mark = SIZE_MAX;
+        EXPECT_EQ(ds_get_mark(&buf_, &mark), ERROR_DS_OK);
+        return mark;
+    }
+};
+
+TEST_F(Reserve_Tests, Commit_Trims_In_Place)
+{
+    void *p = nullptr;
+    ASSERT_EQ(ds_reserve(&buf_, &p, DS_MAX_ALLOCATION_SIZE), ERROR_DS_OK);
+    void *const reserved = p;
+    std::memset(p, 0x3C, 40u);
+
+    ASSERT_EQ(ds_commit(&buf_, &p, 40u), ERROR_DS_OK);
+    EXPECT_EQ(p, reserved);
+    for (size_t i = 0u; i < 40u; i++) {
+        EXPECT_EQ(static_cast<uint8_t *>(p)[i], 0x3Cu);
+    }
+#if DS_ENGINE == DS_ENGINE_BUDDY
+    EXPECT_EQ(UsedBytes(), 64u); /* the smallest buddy holding 40 bytes */
+#else
+    EXPECT_EQ(UsedBytes(), dstest::AlignUp(40u));
+    EXPECT_EQ(Mark(), dstest::AlignUp(40u)); /* the surplus is bump space again */
+#endif
+    EXPECT_EQ(ds_free(&buf_, &p), ERROR_DS_OK);
+}
+
+#if (DS_ENGINE != DS_ENGINE_BUDDY) && (DS_ENGINE != DS_ENGINE_BITMAP)
+TEST_F(Reserve_Tests, Reservation_Prefers_The_Bump_Space)
+{
+    void *hole = Malloc(64u);
+    (void)Malloc(64u);
+    ASSERT_EQ(ds_free(&buf_, &hole), ERROR_DS_OK);
+
+    void *p = nullptr;
+    ASSERT_EQ(ds_reserve(&buf_, &p, 32u), ERROR_DS_OK);
+    EXPECT_EQ(static_cast<uint8_t *>(p) - buf_.memory, 128); /* not the parked hole */
+    ASSERT_EQ(ds_commit(&buf_, &p, 8u), ERROR_DS_OK);
+    EXPECT_EQ(Mark(), 128u + dstest::AlignUp(8u));
+}
+#endif
+
+TEST_F(Reserve_Tests, Reservation_Falls_Back_To_Reuse)
+{
+    void *first = Malloc(DS_MAX_ALLOCATION_SIZE);
+    void *const first_addr = first;
+    for (size_t i = 1u; i < DS_BUFFER_MEMORY_SIZE / DS_MAX_ALLOCATION_SIZE; i++) {
+        (void)Malloc(DS_MAX_ALLOCATION_SIZE); /* bump space used up */
+    }
+    ASSERT_EQ(ds_free(&buf_, &first), ERROR_DS_OK);
+
+    void *p = nullptr;
+    ASSERT_EQ(ds_reserve(&buf_, &p, DS_MAX_ALLOCATION_SIZE / 2u), ERROR_DS_OK);
+    EXPECT_EQ(p, first_addr);
+    ASSERT_EQ(ds_commit(&buf_, &p, 16u), ERROR_DS_OK);
+    EXPECT_EQ(p, first_addr);
+}
+
+TEST_F(Reserve_Tests, Committing_Zero_Abandons_The_Reservation)
+{
+    void *p = nullptr;
+    ASSERT_EQ(ds_reserve(&buf_, &p, 256u), ERROR_DS_OK);
+    ASSERT_EQ(ds_commit(&buf_, &p, 0u), ERROR_DS_OK);
+    EXPECT_EQ(p, nullptr);
+    EXPECT_EQ(UsedBytes(), 0u);
+    EXPECT_EQ(Mark(), 0u);
+}
+
+TEST_F(Reserve_Tests, Bad_Arguments_Are_Rejected)
+{
+    dynostatic_buffer_t uninitialized = { 0 };
+    void *p = nullptr;
+
+    EXPECT_EQ(ds_reserve(NULL, &p, 8u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_reserve(&buf_, NULL, 8u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_reserve(&buf_, &p, 0u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_reserve(&uninitialized, &p, 8u), ERROR_DS_NO_INIT);
+    EXPECT_EQ(ds_reserve(&buf_, &p, DS_MAX_ALLOCATION_SIZE + 1u), ERROR_DS_TOO_BIG_CHUNK);
+
+    EXPECT_EQ(ds_commit(&buf_, &p, 8u), ERROR_DS_INVALID_ARG); /* still NULL */
+    ASSERT_EQ(ds_reserve(&buf_, &p, 64u), ERROR_DS_OK);
+    EXPECT_EQ(ds_reserve(&buf_, &p, 64u), ERROR_DS_PTR_ALLOC_YET);
+    EXPECT_EQ(ds_commit(NULL, &p, 8u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_commit(&buf_, NULL, 8u), ERROR_DS_INVALID_ARG);
+    EXPECT_EQ(ds_commit(&uninitialized, &p, 8u), ERROR_DS_NO_INIT);
+    EXPECT_EQ(ds_commit(&buf_, &p, 65u), ERROR_DS_INVALID_ARG); /* more than reserved */
+
+    void *interior = static_cast<uint8_t *>(p) + DS_ALIGNMENT;
+    EXPECT_EQ(ds_commit(&buf_, &interior, 4u), ERROR_DS_ALLOCATOR_NOT_FOUND);
+    EXPECT_EQ(UsedBytes(), 64u);
+    EXPECT_EQ(ds_commit(&buf_, &p, 64u), ERROR_DS_OK); /* exactly the capacity: nothing to trim */
+    EXPECT_EQ(UsedBytes(), 64u);
+}
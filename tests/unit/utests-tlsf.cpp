@@ -0,0 +1,72 @@
+/**
+ * @file utests-tlsf.cpp
+ * @author Jakub Brzezowski
+ * @copyright Copyright (c) 2026
+ *
+ * @brief Unit tests for the placement of the TLSF engine. Skipped in builds
+ *        of other engines.
+ * @version 1.0
+ * @date 2026-10-16
+ */
+#include "utests-common.hpp"
+
+using dstest::AlignUp;
+using dstest::DsBufferTest;
+
+class Tlsf_Tests : public DsBufferTest {
+  protected:
+    void SetUp() override
+    {
+        if (DS_ENGINE != DS_ENGINE_TLSF) {
+            GTEST_SKIP() << "TLSF placement only";
+        }
+        DsBufferTest::SetUp();
+    }
+
+    /** Parks a block of @p size bytes behind a live guard granule, so
+     *  coalescing cannot merge it; returns its address. */
+    char *Park(size_t size)
+    {
+        char *p = NULL;
+        char *guard = NULL;
+
+        EXPECT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), size), ERROR_DS_OK);
+        EXPECT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&guard), granule_), ERROR_DS_OK);
+        char *const addr = p;
+        EXPECT_EQ(ds_free(&buf_, reinterpret_cast<void **>(&p)), ERROR_DS_OK);
+        return addr;
+    }
+
+    const size_t granule_ = AlignUp(1u);
+};
+
+TEST_F(Tlsf_Tests, Request_Rounds_Up_To_A_List_Whose_Blocks_All_Fit)
+{
+    /* 11 granules round up to the list starting at 12; the 24-granule block
+     * sits in a higher class and is left alone. */
+    char *const large = Park(24u * granule_);
+    char *const snug = Park(12u * granule_);
+    (void)large;
+
+    char *p = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), 11u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(p, snug);
+}
+
+TEST_F(Tlsf_Tests, Straddling_Block_Behind_List_Head_Is_Passed_Over)
+{
+    /* 14 and 15 granules share one second-level list; the later-freed
+     * 14-granule block is its head. */
+    char *const fits = Park(15u * granule_);
+    char *const head = Park(14u * granule_);
+
+    char *p = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&p), 15u * granule_), ERROR_DS_OK);
+    EXPECT_NE(p, fits);
+    EXPECT_NE(p, head);
+
+    /* A request the head covers is still served from the list. */
+    char *q = NULL;
+    ASSERT_EQ(ds_malloc(&buf_, reinterpret_cast<void **>(&q), 14u * granule_), ERROR_DS_OK);
+    EXPECT_EQ(q, head);
+}